@@ -0,0 +1,36 @@
+# Invoked by the glfw-hpp-bench-build-time target. Expects BINARY_DIR, VARIANTS
+# ('|'-separated), OBJECT_ROOT and CONFIG. Dependencies such as the glfw module are
+# built first, so only the synthetic sources are timed.
+
+string(REPLACE "|" ";" variants "${VARIANTS}")
+set(build "${CMAKE_COMMAND}" --build "${BINARY_DIR}")
+if (CONFIG)
+    list(APPEND build --config "${CONFIG}")
+endif()
+
+foreach(variant IN LISTS variants)
+    set(target "glfw-hpp-bench-build-${variant}")
+    execute_process(COMMAND ${build} --target "${target}"
+        RESULT_VARIABLE result OUTPUT_QUIET)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Building ${target} failed")
+    endif()
+    # Drop the objects and precompiled headers but keep the generator's own files
+    file(GLOB_RECURSE outputs
+        "${OBJECT_ROOT}/${target}.dir/*.o"
+        "${OBJECT_ROOT}/${target}.dir/*.obj"
+        "${OBJECT_ROOT}/${target}.dir/*.gch"
+        "${OBJECT_ROOT}/${target}.dir/*.pch"
+    )
+    file(REMOVE ${outputs})
+
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND ${build} --target "${target}"
+        RESULT_VARIABLE result OUTPUT_QUIET)
+    string(TIMESTAMP end "%s%f")
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Rebuilding ${target} failed")
+    endif()
+    math(EXPR total_ms "(${end} - ${start}) / 1000")
+    message(STATUS "${variant}: ${total_ms} ms")
+endforeach()
@@ -0,0 +1,38 @@
+# Invoked by the glfw-hpp-bench-compile-time target. Expects COMPILER, INCLUDE_DIRS
+# ('|'-separated), COUNT and WORK_DIR. Uses GCC/Clang style command lines.
+
+file(MAKE_DIRECTORY "${WORK_DIR}")
+string(REPLACE "|" ";" include_dirs "${INCLUDE_DIRS}")
+set(include_flags)
+foreach(dir IN LISTS include_dirs)
+    if (dir)
+        list(APPEND include_flags "-I${dir}")
+    endif()
+endforeach()
+
+# Every variant compiles the same code, which only needs the Key enum
+set(body "int keyIndex(glfw::Key key) { return static_cast<int>(glfw::enumIndex(key)); }\n")
+
+function(measure header)
+    set(source "${WORK_DIR}/${header}.cpp")
+    file(WRITE "${source}" "#include <glfw-hpp/${header}>\n${body}")
+    string(TIMESTAMP start "%s%f")
+    foreach(i RANGE 1 ${COUNT})
+        execute_process(
+            COMMAND "${COMPILER}" -std=c++20 ${include_flags} -c "${source}" -o "${WORK_DIR}/${header}.o"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE error
+        )
+        if (NOT result EQUAL 0)
+            message(FATAL_ERROR "Compiling against ${header} failed:\n${error}")
+        endif()
+    endforeach()
+    string(TIMESTAMP end "%s%f")
+    math(EXPR total_ms "(${end} - ${start}) / 1000")
+    math(EXPR per_tu_ms "${total_ms} / ${COUNT}")
+    message(STATUS "${header}: ${COUNT} TUs in ${total_ms} ms (${per_tu_ms} ms per TU)")
+endfunction()
+
+measure(glfw_enums.hpp)
+measure(glfw_fwd.hpp)
+measure(glfw.hpp)
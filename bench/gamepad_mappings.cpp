@@ -0,0 +1,78 @@
+// Parse time only of an SDL mapping database: GLFW parsing all of it in
+// updateGamepadMappings, GamepadMappingDatabase indexing the text, and loading the
+// pre-parsed binary index. The file is read before timing, and submitting the few
+// mappings of connected pads afterwards is not measured. GLFW runs on the null
+// platform, which does not affect how it parses mappings.
+// Usage: glfw-hpp-bench-gamepad-mappings gamecontrollerdb.txt
+
+#include <glfw-hpp/glfw_input.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+template <typename Fn>
+double measureMs(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+std::string readFile(const char* path) {
+    std::string text;
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        return text;
+    }
+    char chunk[16384];
+    std::size_t read;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) != 0) {
+        text.append(chunk, read);
+    }
+    std::fclose(file);
+    return text;
+}
+
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <gamecontrollerdb.txt>\n", argv[0]);
+        return 1;
+    }
+    std::string text = readFile(argv[1]);
+    if (text.empty()) {
+        std::fprintf(stderr, "cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    glfw::InitInfo info;
+    info.platform = glfw::InitHintPlatform::eNull;
+    glfw::init(info);
+    double glfwMs = measureMs([&] {
+        (void)glfw::updateGamepadMappings(text);
+    });
+    glfw::terminate();
+
+    std::size_t mappings = 0;
+    double textMs = measureMs([&] {
+        glfw::GamepadMappingDatabase database{text};
+        mappings = database.size();
+    });
+
+    std::string binary = glfw::GamepadMappingDatabase{text}.toBinary();
+    double binaryMs = measureMs([&] {
+        auto database = glfw::GamepadMappingDatabase::fromBinary(binary);
+        mappings = database ? database->size() : 0;
+    });
+
+    std::printf("mappings for this platform: %zu\n", mappings);
+    std::printf("parse time only, no file I/O and no submission\n");
+    std::printf("updateGamepadMappings(full database):  %8.3f ms\n", glfwMs);
+    std::printf("GamepadMappingDatabase from text:      %8.3f ms\n", textMs);
+    std::printf("GamepadMappingDatabase from binary:    %8.3f ms\n", binaryMs);
+    return 0;
+}
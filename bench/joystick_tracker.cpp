@@ -0,0 +1,101 @@
+// Compares JoystickTracker against the per-button loop over raw GLFW state.
+// Input is synthetic, so no joystick has to be connected.
+
+#include <glfw-hpp/glfw_input.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace {
+
+constexpr int kPads = glfw::JoystickTracker::kMaxJoysticks;
+constexpr int kButtons = 32;
+constexpr int kHats = 4;
+constexpr int kFrames = 64;
+constexpr int kIterations = 20000;
+
+struct Frame {
+    unsigned char buttons[kPads][kButtons];
+    unsigned char hats[kPads][kHats];
+    glfw::GamepadState gamepads[kPads];
+};
+
+struct ScalarTransitions {
+    bool pressed[kPads][kButtons + kHats * 4 + GLFW_GAMEPAD_BUTTON_LAST + 1];
+    bool released[kPads][kButtons + kHats * 4 + GLFW_GAMEPAD_BUTTON_LAST + 1];
+    bool held[kPads][kButtons + kHats * 4 + GLFW_GAMEPAD_BUTTON_LAST + 1];
+};
+
+void scalarUpdate(const Frame& prev, const Frame& cur, ScalarTransitions& out) {
+    for (int pad = 0; pad < kPads; ++pad) {
+        int slot = 0;
+        auto compare = [&](bool was, bool is) {
+            out.pressed[pad][slot] = is && !was;
+            out.released[pad][slot] = was && !is;
+            out.held[pad][slot] = was && is;
+            ++slot;
+        };
+        for (int i = 0; i < kButtons; ++i) {
+            compare(prev.buttons[pad][i] == GLFW_PRESS, cur.buttons[pad][i] == GLFW_PRESS);
+        }
+        for (int i = 0; i < kHats; ++i) {
+            for (int bit = 0; bit < 4; ++bit) {
+                compare(prev.hats[pad][i] & (1 << bit), cur.hats[pad][i] & (1 << bit));
+            }
+        }
+        for (int i = 0; i <= GLFW_GAMEPAD_BUTTON_LAST; ++i) {
+            compare(prev.gamepads[pad].buttons[i] == GLFW_PRESS, cur.gamepads[pad].buttons[i] == GLFW_PRESS);
+        }
+    }
+}
+
+template <typename Fn>
+double measure(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        fn(i % kFrames);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / kIterations;
+}
+
+}
+
+int main() {
+    static Frame frames[kFrames];
+    std::mt19937 rng{42};
+    std::bernoulli_distribution pressed{0.2};
+    for (auto& frame : frames) {
+        for (int pad = 0; pad < kPads; ++pad) {
+            for (auto& button : frame.buttons[pad]) {
+                button = pressed(rng) ? GLFW_PRESS : GLFW_RELEASE;
+            }
+            for (auto& hat : frame.hats[pad]) {
+                hat = static_cast<unsigned char>(rng() & 0xF);
+            }
+            for (auto& button : frame.gamepads[pad].buttons) {
+                button = pressed(rng) ? GLFW_PRESS : GLFW_RELEASE;
+            }
+        }
+    }
+
+    static ScalarTransitions scalar;
+    double scalarNs = measure([&](int frame) {
+        scalarUpdate(frames[(frame + kFrames - 1) % kFrames], frames[frame], scalar);
+    });
+
+    glfw::JoystickTracker tracker;
+    volatile std::uint64_t sink = 0;
+    double trackerNs = measure([&](int frame) {
+        for (int pad = 0; pad < kPads; ++pad) {
+            tracker.record(pad, frames[frame].buttons[pad], frames[frame].hats[pad], frames[frame].gamepads[pad].buttons);
+        }
+        tracker.commit();
+        sink = sink + tracker.buttons(glfw::Joystick{frame % kPads}).pressed;
+    });
+
+    std::printf("scalar per-button loop: %8.1f ns/frame\n", scalarNs);
+    std::printf("JoystickTracker:        %8.1f ns/frame\n", trackerNs);
+    return 0;
+}
@@ -0,0 +1,450 @@
+// Times every generated Window and Monitor method, and the common free functions, against
+// the raw GLFW call on the null platform. One JSON object per line:
+//   raw_ns      the C call alone
+//   checked_ns  the C call followed by glfwGetError, which is what every wrapper does
+//   wrapper_ns  the glfw-hpp call
+// The method list is generated from api.yaml, so rerun generate.py after changing it.
+// glfw-hpp-bench-wrapper-overhead-mock links the mock backend instead of GLFW; there every
+// stub costs the same, so wrapper_ns - raw_ns is the overhead of the wrapper alone.
+
+#include <glfw-hpp/glfw.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+namespace {
+
+constexpr int kRepetitions = 5;
+
+// Keeps the optimizer from discarding a result without adding work of its own
+template <typename T>
+void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+struct Fixture {
+    glfw::Window window;
+    ::GLFWwindow* windowHandle = nullptr;
+    glfw::Monitor monitor;
+    ::GLFWmonitor* monitorHandle = nullptr;
+    unsigned char iconPixels[4] = {255, 255, 255, 255};
+    GLFWimage icon{1, 1, iconPixels};
+};
+
+class Runner {
+public:
+    explicit Runner(int iterations) : m_iterations(iterations) {}
+
+    template <typename Wrapper, typename Raw>
+    void run(const char* function, const char* wrapper, Wrapper&& wrapperCall, Raw&& rawCall) {
+        // A call the null platform rejects would throw from every iteration
+        try {
+            wrapperCall();
+        } catch (const glfw::GLFWException& e) {
+            std::printf("{\"function\":\"%s\",\"wrapper\":\"%s\",\"error\":\"%s\"}\n", function, wrapper, e.what());
+            return;
+        }
+
+        double rawNs = measure(rawCall);
+        double checkedNs = measure([&] {
+            rawCall();
+            keep(::glfwGetError(nullptr));
+        });
+        double wrapperNs = measure(wrapperCall);
+        std::printf(
+            "{\"function\":\"%s\",\"wrapper\":\"%s\",\"iterations\":%d,"
+            "\"raw_ns\":%.2f,\"checked_ns\":%.2f,\"wrapper_ns\":%.2f}\n",
+            function, wrapper, m_iterations, rawNs, checkedNs, wrapperNs
+        );
+    }
+
+private:
+    int m_iterations;
+
+    // Best of kRepetitions, in nanoseconds per call
+    template <typename Fn>
+    double measure(Fn&& fn) const {
+        double best = std::numeric_limits<double>::max();
+        for (int repetition = 0; repetition < kRepetitions; ++repetition) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < m_iterations; ++i) {
+                fn();
+            }
+            auto end = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count() / m_iterations);
+        }
+        return best;
+    }
+};
+
+void benchmarkWindow(Runner& runner, Fixture& fixture) {
+// !begin_generated
+// !generate_window_benchmarks
+    runner.run("glfwWindowShouldClose", "Window::shouldClose",
+        [&] { keep(fixture.window.shouldClose()); },
+        [&] {
+            keep(::glfwWindowShouldClose(fixture.windowHandle));
+        });
+    runner.run("glfwSetWindowShouldClose", "Window::setShouldClose",
+        [&] { fixture.window.setShouldClose(false); },
+        [&] {
+            ::glfwSetWindowShouldClose(fixture.windowHandle, GLFW_FALSE);
+        });
+    runner.run("glfwGetWindowTitle", "Window::title",
+        [&] { keep(fixture.window.title()); },
+        [&] {
+            keep(::glfwGetWindowTitle(fixture.windowHandle));
+        });
+    runner.run("glfwSetWindowTitle", "Window::setTitle",
+        [&] { fixture.window.setTitle("bench"); },
+        [&] {
+            ::glfwSetWindowTitle(fixture.windowHandle, "bench");
+        });
+    runner.run("glfwSetWindowIcon", "Window::setIcon",
+        [&] { fixture.window.setIcon(std::span<const GLFWimage>{&fixture.icon, 1}); },
+        [&] {
+            ::glfwSetWindowIcon(fixture.windowHandle, 1, &fixture.icon);
+        });
+    runner.run("glfwGetWindowPos", "Window::position",
+        [&] { keep(fixture.window.position()); },
+        [&] {
+            int xpos{};
+            int ypos{};
+            ::glfwGetWindowPos(fixture.windowHandle, &xpos, &ypos);
+            keep(xpos);
+            keep(ypos);
+        });
+    runner.run("glfwSetWindowPos", "Window::setPosition",
+        [&] { fixture.window.setPosition(0, 0); },
+        [&] {
+            ::glfwSetWindowPos(fixture.windowHandle, 0, 0);
+        });
+    runner.run("glfwGetWindowSize", "Window::size",
+        [&] { keep(fixture.window.size()); },
+        [&] {
+            int width{};
+            int height{};
+            ::glfwGetWindowSize(fixture.windowHandle, &width, &height);
+            keep(width);
+            keep(height);
+        });
+    runner.run("glfwSetWindowSizeLimits", "Window::setSizeLimits",
+        [&] { fixture.window.setSizeLimits(GLFW_DONT_CARE, GLFW_DONT_CARE, GLFW_DONT_CARE, GLFW_DONT_CARE); },
+        [&] {
+            ::glfwSetWindowSizeLimits(fixture.windowHandle, GLFW_DONT_CARE, GLFW_DONT_CARE, GLFW_DONT_CARE, GLFW_DONT_CARE);
+        });
+    runner.run("glfwSetWindowAspectRatio", "Window::setAspectRatio",
+        [&] { fixture.window.setAspectRatio(GLFW_DONT_CARE, GLFW_DONT_CARE); },
+        [&] {
+            ::glfwSetWindowAspectRatio(fixture.windowHandle, GLFW_DONT_CARE, GLFW_DONT_CARE);
+        });
+    runner.run("glfwSetWindowSize", "Window::setSize",
+        [&] { fixture.window.setSize(640, 480); },
+        [&] {
+            ::glfwSetWindowSize(fixture.windowHandle, 640, 480);
+        });
+    runner.run("glfwGetFramebufferSize", "Window::framebufferSize",
+        [&] { keep(fixture.window.framebufferSize()); },
+        [&] {
+            int width{};
+            int height{};
+            ::glfwGetFramebufferSize(fixture.windowHandle, &width, &height);
+            keep(width);
+            keep(height);
+        });
+    runner.run("glfwGetWindowFrameSize", "Window::frameSize",
+        [&] { keep(fixture.window.frameSize()); },
+        [&] {
+            int left{};
+            int top{};
+            int right{};
+            int bottom{};
+            ::glfwGetWindowFrameSize(fixture.windowHandle, &left, &top, &right, &bottom);
+            keep(left);
+            keep(top);
+            keep(right);
+            keep(bottom);
+        });
+    runner.run("glfwGetWindowContentScale", "Window::contentScale",
+        [&] { keep(fixture.window.contentScale()); },
+        [&] {
+            float xscale{};
+            float yscale{};
+            ::glfwGetWindowContentScale(fixture.windowHandle, &xscale, &yscale);
+            keep(xscale);
+            keep(yscale);
+        });
+    runner.run("glfwGetWindowOpacity", "Window::opacity",
+        [&] { keep(fixture.window.opacity()); },
+        [&] {
+            keep(::glfwGetWindowOpacity(fixture.windowHandle));
+        });
+    runner.run("glfwSetWindowOpacity", "Window::setOpacity",
+        [&] { fixture.window.setOpacity(1.0f); },
+        [&] {
+            ::glfwSetWindowOpacity(fixture.windowHandle, 1.0f);
+        });
+    runner.run("glfwIconifyWindow", "Window::iconify",
+        [&] { fixture.window.iconify(); },
+        [&] {
+            ::glfwIconifyWindow(fixture.windowHandle);
+        });
+    runner.run("glfwRestoreWindow", "Window::restore",
+        [&] { fixture.window.restore(); },
+        [&] {
+            ::glfwRestoreWindow(fixture.windowHandle);
+        });
+    runner.run("glfwMaximizeWindow", "Window::maximize",
+        [&] { fixture.window.maximize(); },
+        [&] {
+            ::glfwMaximizeWindow(fixture.windowHandle);
+        });
+    runner.run("glfwShowWindow", "Window::show",
+        [&] { fixture.window.show(); },
+        [&] {
+            ::glfwShowWindow(fixture.windowHandle);
+        });
+    runner.run("glfwHideWindow", "Window::hide",
+        [&] { fixture.window.hide(); },
+        [&] {
+            ::glfwHideWindow(fixture.windowHandle);
+        });
+    runner.run("glfwFocusWindow", "Window::focus",
+        [&] { fixture.window.focus(); },
+        [&] {
+            ::glfwFocusWindow(fixture.windowHandle);
+        });
+    runner.run("glfwRequestWindowAttention", "Window::requestAttention",
+        [&] { fixture.window.requestAttention(); },
+        [&] {
+            ::glfwRequestWindowAttention(fixture.windowHandle);
+        });
+    runner.run("glfwGetWindowMonitor", "Window::monitor",
+        [&] { keep(fixture.window.monitor()); },
+        [&] {
+            keep(::glfwGetWindowMonitor(fixture.windowHandle));
+        });
+    runner.run("glfwGetWindowAttrib", "Window::getAttrib",
+        [&] { keep(fixture.window.getAttrib(glfw::WindowAttrib::eFocused)); },
+        [&] {
+            keep(::glfwGetWindowAttrib(fixture.windowHandle, GLFW_FOCUSED));
+        });
+    runner.run("glfwSetWindowAttrib", "Window::setAttrib",
+        [&] { fixture.window.setAttrib(glfw::WindowAttrib::eDecorated, true); },
+        [&] {
+            ::glfwSetWindowAttrib(fixture.windowHandle, GLFW_DECORATED, GLFW_TRUE);
+        });
+    runner.run("glfwGetInputMode", "Window::getInputMode",
+        [&] { keep(fixture.window.getInputMode(glfw::InputMode::eCursor)); },
+        [&] {
+            keep(::glfwGetInputMode(fixture.windowHandle, GLFW_CURSOR));
+        });
+    runner.run("glfwSetInputMode", "Window::setInputMode",
+        [&] { fixture.window.setInputMode(glfw::InputMode::eStickyKeys, GLFW_FALSE); },
+        [&] {
+            ::glfwSetInputMode(fixture.windowHandle, GLFW_STICKY_KEYS, GLFW_FALSE);
+        });
+    runner.run("glfwGetKey", "Window::getKey",
+        [&] { keep(fixture.window.getKey(glfw::Key::eSpace)); },
+        [&] {
+            keep(::glfwGetKey(fixture.windowHandle, GLFW_KEY_SPACE));
+        });
+    runner.run("glfwGetMouseButton", "Window::getMouseButton",
+        [&] { keep(fixture.window.getMouseButton(glfw::Button::eLeft)); },
+        [&] {
+            keep(::glfwGetMouseButton(fixture.windowHandle, GLFW_MOUSE_BUTTON_LEFT));
+        });
+    runner.run("glfwGetCursorPos", "Window::cursorPosition",
+        [&] { keep(fixture.window.cursorPosition()); },
+        [&] {
+            double xpos{};
+            double ypos{};
+            ::glfwGetCursorPos(fixture.windowHandle, &xpos, &ypos);
+            keep(xpos);
+            keep(ypos);
+        });
+    runner.run("glfwSetCursorPos", "Window::setCursorPosition",
+        [&] { fixture.window.setCursorPosition(0.0, 0.0); },
+        [&] {
+            ::glfwSetCursorPos(fixture.windowHandle, 0.0, 0.0);
+        });
+    runner.run("glfwSetClipboardString", "Window::setClipboardString",
+        [&] { fixture.window.setClipboardString("bench"); },
+        [&] {
+            ::glfwSetClipboardString(fixture.windowHandle, "bench");
+        });
+    runner.run("glfwGetClipboardString", "Window::clipboardString",
+        [&] { keep(fixture.window.clipboardString()); },
+        [&] {
+            keep(::glfwGetClipboardString(fixture.windowHandle));
+        });
+// !end_generated
+}
+
+void benchmarkMonitor(Runner& runner, Fixture& fixture) {
+// !begin_generated
+// !generate_monitor_benchmarks
+    runner.run("glfwGetMonitorPos", "Monitor::position",
+        [&] { keep(fixture.monitor.position()); },
+        [&] {
+            int xpos{};
+            int ypos{};
+            ::glfwGetMonitorPos(fixture.monitorHandle, &xpos, &ypos);
+            keep(xpos);
+            keep(ypos);
+        });
+    runner.run("glfwGetMonitorWorkarea", "Monitor::workarea",
+        [&] { keep(fixture.monitor.workarea()); },
+        [&] {
+            int xpos{};
+            int ypos{};
+            int width{};
+            int height{};
+            ::glfwGetMonitorWorkarea(fixture.monitorHandle, &xpos, &ypos, &width, &height);
+            keep(xpos);
+            keep(ypos);
+            keep(width);
+            keep(height);
+        });
+    runner.run("glfwGetMonitorPhysicalSize", "Monitor::physicalSize",
+        [&] { keep(fixture.monitor.physicalSize()); },
+        [&] {
+            int widthMM{};
+            int heightMM{};
+            ::glfwGetMonitorPhysicalSize(fixture.monitorHandle, &widthMM, &heightMM);
+            keep(widthMM);
+            keep(heightMM);
+        });
+    runner.run("glfwGetMonitorContentScale", "Monitor::contentScale",
+        [&] { keep(fixture.monitor.contentScale()); },
+        [&] {
+            float xscale{};
+            float yscale{};
+            ::glfwGetMonitorContentScale(fixture.monitorHandle, &xscale, &yscale);
+            keep(xscale);
+            keep(yscale);
+        });
+    runner.run("glfwGetMonitorName", "Monitor::name",
+        [&] { keep(fixture.monitor.name()); },
+        [&] {
+            keep(::glfwGetMonitorName(fixture.monitorHandle));
+        });
+    runner.run("glfwGetVideoModes", "Monitor::videoModes",
+        [&] { keep(fixture.monitor.videoModes()); },
+        [&] {
+            int count{};
+            keep(::glfwGetVideoModes(fixture.monitorHandle, &count));
+            keep(count);
+        });
+    runner.run("glfwGetVideoMode", "Monitor::videoMode",
+        [&] { keep(fixture.monitor.videoMode()); },
+        [&] {
+            keep(::glfwGetVideoMode(fixture.monitorHandle));
+        });
+    runner.run("glfwSetGamma", "Monitor::setGamma",
+        [&] { fixture.monitor.setGamma(1.0f); },
+        [&] {
+            ::glfwSetGamma(fixture.monitorHandle, 1.0f);
+        });
+// !end_generated
+}
+
+// Free functions are written by hand in glfw.hpp, so they are listed by hand here
+void benchmarkFreeFunctions(Runner& runner) {
+    runner.run("glfwGetVersion", "getVersion",
+        [&] { keep(glfw::getVersion()); },
+        [&] {
+            int major{}, minor{}, rev{};
+            ::glfwGetVersion(&major, &minor, &rev);
+            keep(major);
+            keep(minor);
+            keep(rev);
+        });
+    runner.run("glfwGetVersionString", "getVersionString",
+        [&] { keep(glfw::getVersionString()); },
+        [&] { keep(::glfwGetVersionString()); });
+    runner.run("glfwGetPlatform", "getPlatform",
+        [&] { keep(glfw::getPlatform()); },
+        [&] { keep(::glfwGetPlatform()); });
+    runner.run("glfwPlatformSupported", "isPlatformSupported",
+        [&] { keep(glfw::isPlatformSupported(glfw::Platform::eNull)); },
+        [&] { keep(::glfwPlatformSupported(GLFW_PLATFORM_NULL)); });
+    runner.run("glfwGetMonitors", "getMonitors",
+        [&] { keep(glfw::getMonitors()); },
+        [&] {
+            int count{};
+            keep(::glfwGetMonitors(&count));
+            keep(count);
+        });
+    runner.run("glfwGetPrimaryMonitor", "getPrimaryMonitor",
+        [&] { keep(glfw::getPrimaryMonitor()); },
+        [&] { keep(::glfwGetPrimaryMonitor()); });
+    runner.run("glfwPollEvents", "pollEvents",
+        [&] { glfw::pollEvents(); },
+        [&] { ::glfwPollEvents(); });
+    runner.run("glfwRawMouseMotionSupported", "rawMouseMotionSupported",
+        [&] { keep(glfw::rawMouseMotionSupported()); },
+        [&] { keep(::glfwRawMouseMotionSupported()); });
+    runner.run("glfwGetKeyName", "keyName",
+        [&] { keep(glfw::keyName(glfw::Key::eA)); },
+        [&] { keep(::glfwGetKeyName(GLFW_KEY_A, 0)); });
+    runner.run("glfwGetKeyScancode", "keyScancode",
+        [&] { keep(glfw::keyScancode(glfw::Key::eA)); },
+        [&] { keep(::glfwGetKeyScancode(GLFW_KEY_A)); });
+    runner.run("glfwGetTime", "time",
+        [&] { keep(glfw::time()); },
+        [&] { keep(::glfwGetTime()); });
+    runner.run("glfwGetTimerValue", "timerValue",
+        [&] { keep(glfw::timerValue()); },
+        [&] { keep(::glfwGetTimerValue()); });
+    runner.run("glfwGetTimerFrequency", "timerFrequency",
+        [&] { keep(glfw::timerFrequency()); },
+        [&] { keep(::glfwGetTimerFrequency()); });
+}
+
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 100000;
+    if (iterations <= 0) {
+        std::fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    glfw::InitInfo initInfo;
+    initInfo.platform = glfw::InitHintPlatform::eNull;
+    glfw::init(initInfo);
+
+    glfw::WindowCreateInfo windowInfo;
+    windowInfo.width = 640;
+    windowInfo.height = 480;
+    windowInfo.title = "bench";
+    windowInfo.clientApi = glfw::WindowHintClientApi::eNoApi;
+
+    Fixture fixture;
+    fixture.window = glfw::createWindow(windowInfo);
+    fixture.windowHandle = fixture.window.handle();
+    fixture.monitor = glfw::getPrimaryMonitor();
+    fixture.monitorHandle = fixture.monitor.handle();
+
+    Runner runner{iterations};
+    benchmarkWindow(runner, fixture);
+    if (fixture.monitorHandle) {
+        benchmarkMonitor(runner, fixture);
+    }
+    benchmarkFreeFunctions(runner);
+
+    fixture.window.destroy();
+    glfw::terminate();
+    return 0;
+}
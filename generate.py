@@ -38,6 +38,26 @@ def to_title_case(name):
     return "".join([i.title() for i in name.split("_")])
 
 
+# Must match enumNameHash() in glfw.hpp
+def enum_name_hash(seed, name):
+    hash = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in name.encode():
+        hash = ((hash ^ c) * 16777619) & 0xFFFFFFFF
+    return hash
+
+
+def find_perfect_hash(names):
+    size = 1
+    while size < 2 * len(names):
+        size *= 2
+    while True:
+        for seed in range(1 << 16):
+            slots = set(enum_name_hash(seed, i) & (size - 1) for i in names)
+            if len(slots) == len(names):
+                return seed, size
+        size *= 2
+
+
 def to_camel_case(name):
     name = to_title_case(name)
     name = name[0].lower() + name[1:]
@@ -117,10 +137,98 @@ def cpp_params(parameters):
     return result
 
 
+HEADERS = [
+    "./include/glfw-hpp/glfw.hpp",
+    "./include/glfw-hpp/glfw_profiling.hpp",
+    "./include/glfw-hpp/glfw_enums.hpp",
+    "./include/glfw-hpp/glfw_fwd.hpp",
+    "./include/glfw-hpp/glfw_c_api.hpp",
+    "./mock/glfw_mock.hpp",
+    "./mock/glfw_mock.cpp",
+    "./bench/wrapper_overhead.cpp",
+]
+
+# Headers whose exported classes glfw_fwd.hpp declares
+DECLARATION_HEADERS = [
+    "./include/glfw-hpp/glfw.hpp",
+    "./include/glfw-hpp/glfw_profiling.hpp",
+    "./include/glfw-hpp/glfw_input.hpp",
+    "./include/glfw-hpp/glfw_timing.hpp",
+    "./include/glfw-hpp/glfw_context.hpp",
+    "./include/glfw-hpp/glfw_image.hpp",
+]
+
+# Values the mock returns until a test sets its own; everything else is value-initialized
+MOCK_DEFAULT_RETURNS = {
+    "glfwInit": "GLFW_TRUE",
+    "glfwGetVersionString": "\"3.4.0 mock\"",
+    "glfwGetPlatform": "GLFW_PLATFORM_NULL",
+    "glfwPlatformSupported": "GLFW_TRUE",
+    "glfwGetTimerValue": "glfw_mock::advanceTimer()",
+    "glfwGetTimerFrequency": "glfw_mock::kTimerFrequency",
+    "glfwCreateWindow": "glfw_mock::makeHandle<GLFWwindow>()",
+    "glfwCreateCursor": "glfw_mock::makeHandle<GLFWcursor>()",
+    "glfwCreateStandardCursor": "glfw_mock::makeHandle<GLFWcursor>()",
+    "glfwGetPrimaryMonitor": "glfw_mock::primaryMonitor()",
+}
+
+# Arguments the wrapper benchmark passes to methods taking input, as (C, C++) expressions.
+# Methods with input missing here are not benchmarked.
+BENCH_ARGUMENTS = {
+    "glfwSetGamma": (["1.0f"], ["1.0f"]),
+    "glfwSetWindowShouldClose": (["GLFW_FALSE"], ["false"]),
+    "glfwSetWindowTitle": (["\"bench\""], ["\"bench\""]),
+    "glfwSetWindowIcon": (["1", "&fixture.icon"], ["std::span<const GLFWimage>{&fixture.icon, 1}"]),
+    "glfwSetWindowPos": (["0", "0"], ["0", "0"]),
+    "glfwSetWindowSizeLimits": (["GLFW_DONT_CARE"] * 4, ["GLFW_DONT_CARE"] * 4),
+    "glfwSetWindowAspectRatio": (["GLFW_DONT_CARE", "GLFW_DONT_CARE"], ["GLFW_DONT_CARE", "GLFW_DONT_CARE"]),
+    "glfwSetWindowSize": (["640", "480"], ["640", "480"]),
+    "glfwSetWindowOpacity": (["1.0f"], ["1.0f"]),
+    "glfwGetWindowAttrib": (["GLFW_FOCUSED"], ["glfw::WindowAttrib::eFocused"]),
+    "glfwSetWindowAttrib": (["GLFW_DECORATED", "GLFW_TRUE"], ["glfw::WindowAttrib::eDecorated", "true"]),
+    "glfwGetInputMode": (["GLFW_CURSOR"], ["glfw::InputMode::eCursor"]),
+    "glfwSetInputMode": (["GLFW_STICKY_KEYS", "GLFW_FALSE"], ["glfw::InputMode::eStickyKeys", "GLFW_FALSE"]),
+    "glfwGetKey": (["GLFW_KEY_SPACE"], ["glfw::Key::eSpace"]),
+    "glfwGetMouseButton": (["GLFW_MOUSE_BUTTON_LEFT"], ["glfw::Button::eLeft"]),
+    "glfwSetCursorPos": (["0.0", "0.0"], ["0.0", "0.0"]),
+    "glfwSetClipboardString": (["\"bench\""], ["\"bench\""]),
+}
+
+# The benchmark window has no context and must stay windowed
+BENCH_SKIPPED = ("glfwSwapBuffers", "glfwSetWindowMonitor")
+
+
+def mock_stub_name(function):
+    name = function["name"].removeprefix("glfw")
+    return name[0].lower() + name[1:]
+
+
+def mock_return_type(function):
+    # api.yaml records the wrapper's return type; the mock needs the C one
+    return function["c_signature"].split(function["name"] + "(")[0].strip()
+
+
+def mock_is_callback_setter(function):
+    return function["name"].startswith("glfwSet") and function["name"].endswith("Callback")
+
+
+def mock_is_window_function(function):
+    params = function["parameters"]
+    return bool(params) and params[0]["type"] == "GLFWwindow*"
+
+
+def mock_callback_name(function):
+    name = function["name"].removeprefix("glfwSet").removesuffix("Callback")
+    if name == "Char":
+        return "character"
+    return name[0].lower() + name[1:]
+
+
 class Generator:
-    def __init__(self, api, template):
+    def __init__(self, api, template, declarations=()):
         self.api = api
         self.template = template
+        self.declarations = declarations
         self.indent = 0
         self.output = io.StringIO()
 
@@ -156,6 +264,208 @@ class Generator:
             if name not in ("const", "joystick"):
                 self.generate_enum(name)
 
+    def define_value(self, define):
+        defines = self.api["defines"]
+        if define in defines:
+            return defines[define]
+        # GLFW_PLATFORM_ANY and GLFW_RELEASE_BEHAVIOR_ANY are aliases of GLFW_ANY_*
+        return defines[define.removesuffix("_ANY").replace("GLFW_", "GLFW_ANY_", 1)]
+
+    def generate_enum_reflection(self):
+        for name, data in self.api["enums"].items():
+            if name in ("const", "joystick"):
+                continue
+            prefix = data.get("prefix", "")
+            suffix = data.get("suffix", "")
+            enum_name = to_title_case(name)
+
+            # Aliases (e.g. Key::eLast) share a value with an earlier enumerator and are left out
+            entries = []
+            seen = set()
+            for value in data["values"]:
+                number = self.define_value(value)
+                if number in seen:
+                    continue
+                seen.add(number)
+                entries.append(define_to_enumerator_name(value.removeprefix(prefix).removesuffix(suffix)))
+
+            names = [i.removeprefix("e") for i in entries]
+            seed, size = find_perfect_hash(names)
+            table = [0] * size
+            for index, i in enumerate(names):
+                table[enum_name_hash(seed, i) & (size - 1)] = index + 1
+
+            with self.block(f"template <> struct EnumTraits<{enum_name}> {{", "};"):
+                self.line(f"static constexpr std::size_t count = {len(entries)};")
+                self.line(f"static constexpr std::uint32_t hashSeed = {seed};")
+                with self.block(f"static constexpr std::array<{enum_name}, count> values = {{", "};"):
+                    for i in entries:
+                        self.line(f"{enum_name}::{i},")
+                with self.block("static constexpr std::array<std::string_view, count> names = {", "};"):
+                    for i in names:
+                        self.line(f"\"{i}\",")
+                with self.block(f"static constexpr std::array<std::uint16_t, {size}> hashTable = {{", "};"):
+                    for start in range(0, size, 16):
+                        self.line(", ".join(str(i) for i in table[start:start + 16]) + ",")
+                with self.block(f"static constexpr std::size_t index({enum_name} value) noexcept {{"):
+                    with self.block("switch (value) {"):
+                        for index, i in enumerate(entries):
+                            self.line(f"case {enum_name}::{i}: return {index};")
+                    self.line("return count;")
+            self.skip()
+
+    def mock_functions(self):
+        for function in self.api["functions"]:
+            features = function.get("features", [])
+            if "webgpu" in features:
+                continue
+            yield function, "vulkan" in features
+
+    def generate_mock_declarations(self):
+        for function, vulkan in self.mock_functions():
+            if vulkan:
+                self.line("#ifdef VK_VERSION_1_0")
+            stub_type = function["name"].removeprefix("glfw") + "Stub"
+            with self.block(f"struct {stub_type} {{", "};"):
+                self.line("std::uint64_t calls = 0;")
+                self.line("int error = GLFW_NO_ERROR;")
+                special = mock_is_callback_setter(function) or "UserPointer" in function["name"]
+                if function["name"] != "glfwGetError":
+                    for param in function["parameters"]:
+                        if param.get("out"):
+                            self.line(f"{param['type'].removesuffix('*')} {param['name']}{{}};")
+                    return_type = mock_return_type(function)
+                    if return_type != "void" and not special:
+                        self.line(f"std::optional<{return_type}> returns;")
+            if vulkan:
+                self.line("#endif")
+            self.skip()
+
+        with self.block("struct State {", "};"):
+            for function, vulkan in self.mock_functions():
+                if vulkan:
+                    self.line("#ifdef VK_VERSION_1_0")
+                self.line(f"{function['name'].removeprefix('glfw')}Stub {mock_stub_name(function)};")
+                if vulkan:
+                    self.line("#endif")
+        self.skip()
+
+        for scope, window in (("Window", True), ("Global", False)):
+            with self.block(f"struct {scope}Callbacks {{", "};"):
+                for function, _ in self.mock_functions():
+                    if mock_is_callback_setter(function) and mock_is_window_function(function) == window:
+                        self.line(f"{function['return']['type']} {mock_callback_name(function)} = nullptr;")
+            if window:
+                self.skip()
+
+    def generate_mock_definitions(self):
+        for function, vulkan in self.mock_functions():
+            name = function["name"]
+            if name == "glfwGetError":
+                continue
+            params = function["parameters"]
+            return_type = mock_return_type(function)
+            used = set(i["name"] for i in params if i.get("out"))
+            callback = mock_is_callback_setter(function)
+            user_pointer = "UserPointer" in name
+            if callback or user_pointer:
+                used.update(i["name"] for i in params)
+
+            signature = ", ".join(i["type"] + (" " + i["name"] if i["name"] in used else "") for i in params)
+            if vulkan:
+                self.line("#ifdef VK_VERSION_1_0")
+            with self.block(f"{return_type} {name}({signature}) {{"):
+                self.line("std::lock_guard lock{glfw_mock::mutex()};")
+                self.line(f"auto& stub = glfw_mock::state().{mock_stub_name(function)};")
+                self.line("stub.calls += 1;")
+                self.line("glfw_mock::raise(stub.error);")
+                for param in params:
+                    if param.get("out"):
+                        with self.block(f"if ({param['name']} != nullptr) {{"):
+                            self.line(f"*{param['name']} = stub.{param['name']};")
+                if callback:
+                    if mock_is_window_function(function):
+                        store = f"glfw_mock::windowCallbacks({params[0]['name']})"
+                    else:
+                        store = "glfw_mock::globalCallbacks()"
+                    self.line(f"return std::exchange({store}.{mock_callback_name(function)}, {params[-1]['name']});")
+                elif user_pointer:
+                    key = params[0]
+                    if key["type"] == "int":
+                        slot = f"glfw_mock::joystickUserPointer({key['name']})"
+                    else:
+                        slot = f"glfw_mock::storage().userPointers[{key['name']}]"
+                    if name.startswith("glfwSet"):
+                        self.line(f"{slot} = {params[1]['name']};")
+                    else:
+                        self.line(f"return {slot};")
+                elif return_type != "void":
+                    default = MOCK_DEFAULT_RETURNS.get(name)
+                    if default is None:
+                        if return_type == "const char*":
+                            default = "\"\""
+                        elif return_type.endswith("*"):
+                            default = "nullptr"
+                        else:
+                            default = f"{return_type}{{}}"
+                    self.line(f"return stub.returns ? *stub.returns : {default};")
+            if vulkan:
+                self.line("#endif")
+            self.skip()
+
+    def generate_wrapper_benchmarks(self, kind):
+        self.indent += 1
+        for function, method_name, params in self.wrapped_methods(kind):
+            name = function["name"]
+            in_params = [i for i in params if not i["out"] and i["cpp_type"] is not None]
+            out_params = [i for i in params if i["out"]]
+            if name in BENCH_SKIPPED or (in_params and name not in BENCH_ARGUMENTS):
+                continue
+            c_args, cpp_args = BENCH_ARGUMENTS.get(name, ([], []))
+            call = f"fixture.{kind}.{method_name}({', '.join(cpp_args)})"
+            if function["return"]["type"] != "void" or out_params:
+                call = f"keep({call})"
+            self.line(f"runner.run(\"{name}\", \"{kind.title()}::{method_name}\",")
+            self.indent += 1
+            self.line(f"[&] {{ {call}; }},")
+            with self.block("[&] {", "});"):
+                for i in out_params:
+                    self.line(f"{i['c_type'].removesuffix('*')} {i['name']}{{}};")
+                args = [f"fixture.{kind}Handle"]
+                c_args = iter(c_args)
+                for i in params:
+                    args.append(f"&{i['name']}" if i["out"] else next(c_args))
+                raw = f"::{name}({', '.join(args)})"
+                if function["return"]["type"] != "void":
+                    raw = f"keep({raw})"
+                self.line(f"{raw};")
+                for i in out_params:
+                    self.line(f"keep({i['name']});")
+            self.indent -= 1
+        self.indent -= 1
+
+    def generate_forward_declarations(self):
+        current = None
+        for kind, name, condition in self.declarations:
+            if condition != current:
+                if current:
+                    self.line(f"#endif")
+                if condition:
+                    self.line(f"#ifdef {condition}")
+                current = condition
+            self.line(f"GLFW_HPP_EXPORT {kind} {name};")
+        if current:
+            self.line(f"#endif")
+
+    def generate_profiled_functions(self):
+        with self.block("GLFW_HPP_EXPORT enum class ProfiledFunction {", "};"):
+            for function in self.api["functions"]:
+                self.line(f"e{function['name'].removeprefix('glfw')},")
+            self.line("eCount,")
+        with self.block("constexpr std::string_view profiledFunctionNames[] = {", "};"):
+            for function in self.api["functions"]:
+                self.line(f"\"{function['name']}\",")
+
     def generate_c_api(self):
         for type_str in self.api["types"]:
             self.line(f"export using ::{type_str};")
@@ -192,6 +502,8 @@ class Generator:
         for raw_name, raw_type in self.api["hints"][f"{kind}_hint"].items():
             name = to_camel_case(raw_name.removeprefix("GLFW_"))
             with self.block(f"if (info.{name}) {{"):
+                if kind == "window":
+                    self.line("GLFW_HPP_PROFILE(WindowHint);")
                 if raw_type == "string":
                     self.line(f"::glfw{kind.title()}HintString({raw_name}, info.{name}.value().c_str());")
                 else:
@@ -229,7 +541,7 @@ class Generator:
     def generate_window_callback_setup(self):
         self.indent += 2
         for event, info in self.api["window_events"].items():
-            if event == "Drop":
+            if event in ("Drop", "Char", "CharMods"):
                 continue
             type_name = f"GLFW{event.lower()}fun"
             params = cpp_params(info["parameters"])
@@ -238,6 +550,7 @@ class Generator:
             with self.block(f"::glfwSet{event}Callback(m_window, []({lambda_params}) {{", "});"):
                 self.line("auto peer = reinterpret_cast<WindowPeer*>(::glfwGetWindowUserPointer(window));")
                 with self.block(f"if (peer && peer->handle{event}) {{"):
+                    self.line(f"GLFW_HPP_TRACE_SCOPE(\"{event}\");")
                     forward = [i["forward"].replace("NAME", i["name"]) for i in params if i["forward"] is not None]
                     self.line(f"peer->handle{event}({', '.join(forward)});")
             self.skip()
@@ -250,22 +563,22 @@ class Generator:
             with self.block(f"void set{event}Handler({type} handler) const {{"):
                 self.line(f"getPeer()->handle{event} = std::move(handler);")
             self.skip()
+            with self.block(f"GLFW_HPP_NODISCARD {type} get{event}Handler() const {{"):
+                self.line(f"return getPeer()->handle{event};")
+            self.skip()
         self.indent -= 1
 
-    def generate_methods(self, kind):
-        self.indent += 1
+    # Functions wrapped as methods of `kind`, with the method name and the C++ parameters
+    def wrapped_methods(self, kind):
         for function in self.api["functions"]:
             receiver = function.get("receiver")
             if receiver != kind:
                 continue
             name = function["name"]
-            if name in ("glfwDestroyWindow", "glfwSetGammaRamp", "glfwGetGammaRamp", "glfwSetCursor"):
+            if name in ("glfwDestroyWindow", "glfwSetGammaRamp", "glfwGetGammaRamp", "glfwSetCursor", "glfwMakeContextCurrent"):
                 continue
-            return_type = function["return"]["type"]
-            return_enum = function["return"].get("enum")
             params = cpp_params(function["parameters"][1:])
             in_params = [i for i in params if not i["out"]]
-            out_params = [i for i in params if i["out"]]
             method_name = name.removeprefix("glfw").replace(kind.title(), "")
             if "Callback" in method_name or "UserPointer" in method_name:
                 continue
@@ -274,6 +587,15 @@ class Generator:
             if method_name.endswith("Pos"):
                 method_name += "ition"
             method_name = method_name[0].lower() + method_name[1:]
+            yield function, method_name, params
+
+    def generate_methods(self, kind):
+        self.indent += 1
+        for function, method_name, params in self.wrapped_methods(kind):
+            name = function["name"]
+            return_type = function["return"]["type"]
+            return_enum = function["return"].get("enum")
+            out_params = [i for i in params if i["out"]]
 
             return_counted_by = None
             for i in out_params:
@@ -311,6 +633,7 @@ class Generator:
                     else:
                         args.append(i["backward"].replace("NAME", i["name"]))
                 args_str = ", ".join(args)
+                self.line(f"GLFW_HPP_PROFILE({name.removeprefix('glfw')});")
                 if return_type == "void":
                     self.line(f"::{name}({args_str});")
                 else:
@@ -340,6 +663,16 @@ class Generator:
 
                 if cmd == "generate_enums":
                     self.generate_enums()
+                elif cmd == "generate_mock_declarations":
+                    self.generate_mock_declarations()
+                elif cmd == "generate_mock_definitions":
+                    self.generate_mock_definitions()
+                elif cmd == "generate_forward_declarations":
+                    self.generate_forward_declarations()
+                elif cmd == "generate_enum_reflection":
+                    self.generate_enum_reflection()
+                elif cmd == "generate_profiled_functions":
+                    self.generate_profiled_functions()
                 elif cmd == "generate_c_api":
                     self.generate_c_api()
                 elif cmd == "generate_init_hint_defs":
@@ -360,20 +693,57 @@ class Generator:
                     self.generate_window_attributes()
                 elif cmd == "generate_monitor_methods":
                     self.generate_methods("monitor")
+                elif cmd == "generate_window_benchmarks":
+                    self.generate_wrapper_benchmarks("window")
+                elif cmd == "generate_monitor_benchmarks":
+                    self.generate_wrapper_benchmarks("monitor")
 
                 print(f"// !end_generated", file=self.output)
             elif not in_generated:
                 print(line, file=self.output)
 
+# Classes, structs and class templates of a header, for glfw_fwd.hpp, with the innermost
+# GLFW_HPP_ENABLE_* option they are declared under
+def find_declarations(source):
+    declarations = []
+    conditions = []
+    template = None
+    for line in source.splitlines():
+        if line.startswith("#if"):
+            option = re.match(r"#ifdef (GLFW_HPP_ENABLE_\w+)", line)
+            conditions.append(option.group(1) if option else None)
+        elif line.startswith("#endif"):
+            conditions.pop()
+        elif match := re.match(r"GLFW_HPP_EXPORT template <(.*)>$", line):
+            template = match.group(1)
+            continue
+        elif match := re.match(r"(?:GLFW_HPP_EXPORT |)(class|struct) (\w+)\b", line):
+            if template is not None or line.startswith("GLFW_HPP_EXPORT"):
+                condition = next((c for c in reversed(conditions) if c), None)
+                kind = match.group(1)
+                if template is not None:
+                    # Default arguments may only appear once, on the definition
+                    parameters = ", ".join(i.split("=")[0].strip() for i in template.split(","))
+                    kind = f"template <{parameters}> {kind}"
+                declarations.append((kind, match.group(2), condition))
+        template = None
+    return declarations
+
+
 def main():
     with open("api.yaml") as api_file:
         api = yaml.load(api_file, yaml.Loader)
-    with open("./include/glfw-hpp/glfw.hpp", "r") as template_file:
-        template = template_file.read()
-    gen = Generator(api, template)
-    gen.generate()
-    with open("./include/glfw-hpp/glfw.hpp", "w") as output_file:
-        output_file.write(gen.output.getvalue())
+    declarations = []
+    for path in DECLARATION_HEADERS:
+        with open(path, "r") as header_file:
+            declarations += find_declarations(header_file.read())
+    for path in HEADERS:
+        with open(path, "r") as template_file:
+            template = template_file.read()
+        gen = Generator(api, template, declarations)
+        gen.generate()
+        with open(path, "w") as output_file:
+            output_file.write(gen.output.getvalue())
 
 
 
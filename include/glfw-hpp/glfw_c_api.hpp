@@ -0,0 +1,873 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Exports of the plain C API, included by glfw.hpp when building the glfw_c module.
+// Not a public header: it is installed only for the glfw_c module interface to include.
+
+#if !defined(GLFW_HPP_MODULE) || !defined(GLFW_HPP_MODULE_EXPORT_C_API)
+#error "glfw_c_api.hpp is part of the glfw_c module; import glfw_c or include glfw.hpp instead"
+#endif
+
+#ifdef GLFW_HPP_C_API_NAMESPACE
+namespace GLFW_HPP_C_API_NAMESPACE {
+#endif
+
+// !begin_generated
+// !generate_c_api
+export using ::GLFWmonitor;
+export using ::GLFWwindow;
+export using ::GLFWcursor;
+export using ::GLFWvidmode;
+export using ::GLFWgammaramp;
+export using ::GLFWimage;
+export using ::GLFWgamepadstate;
+export using ::GLFWallocator;
+export using ::GLFWglproc;
+export using ::GLFWvkproc;
+export using ::GLFWallocatefun;
+export using ::GLFWreallocatefun;
+export using ::GLFWdeallocatefun;
+export using ::GLFWerrorfun;
+export using ::GLFWwindowposfun;
+export using ::GLFWwindowsizefun;
+export using ::GLFWwindowclosefun;
+export using ::GLFWwindowrefreshfun;
+export using ::GLFWwindowfocusfun;
+export using ::GLFWwindowiconifyfun;
+export using ::GLFWwindowmaximizefun;
+export using ::GLFWframebuffersizefun;
+export using ::GLFWwindowcontentscalefun;
+export using ::GLFWmousebuttonfun;
+export using ::GLFWcursorposfun;
+export using ::GLFWcursorenterfun;
+export using ::GLFWscrollfun;
+export using ::GLFWkeyfun;
+export using ::GLFWcharfun;
+export using ::GLFWcharmodsfun;
+export using ::GLFWdropfun;
+export using ::GLFWmonitorfun;
+export using ::GLFWjoystickfun;
+export using ::glfwInit;
+export using ::glfwTerminate;
+export using ::glfwInitHint;
+export using ::glfwInitAllocator;
+#ifdef VK_VERSION_1_0
+export using ::glfwInitVulkanLoader;
+#endif // VK_VERSION_1_0
+export using ::glfwGetVersion;
+export using ::glfwGetVersionString;
+export using ::glfwGetError;
+export using ::glfwSetErrorCallback;
+export using ::glfwGetPlatform;
+export using ::glfwPlatformSupported;
+export using ::glfwGetMonitors;
+export using ::glfwGetPrimaryMonitor;
+export using ::glfwGetMonitorPos;
+export using ::glfwGetMonitorWorkarea;
+export using ::glfwGetMonitorPhysicalSize;
+export using ::glfwGetMonitorContentScale;
+export using ::glfwGetMonitorName;
+export using ::glfwSetMonitorUserPointer;
+export using ::glfwGetMonitorUserPointer;
+export using ::glfwSetMonitorCallback;
+export using ::glfwGetVideoModes;
+export using ::glfwGetVideoMode;
+export using ::glfwSetGamma;
+export using ::glfwGetGammaRamp;
+export using ::glfwSetGammaRamp;
+export using ::glfwDefaultWindowHints;
+export using ::glfwWindowHint;
+export using ::glfwWindowHintString;
+export using ::glfwCreateWindow;
+export using ::glfwDestroyWindow;
+export using ::glfwWindowShouldClose;
+export using ::glfwSetWindowShouldClose;
+export using ::glfwGetWindowTitle;
+export using ::glfwSetWindowTitle;
+export using ::glfwSetWindowIcon;
+export using ::glfwGetWindowPos;
+export using ::glfwSetWindowPos;
+export using ::glfwGetWindowSize;
+export using ::glfwSetWindowSizeLimits;
+export using ::glfwSetWindowAspectRatio;
+export using ::glfwSetWindowSize;
+export using ::glfwGetFramebufferSize;
+export using ::glfwGetWindowFrameSize;
+export using ::glfwGetWindowContentScale;
+export using ::glfwGetWindowOpacity;
+export using ::glfwSetWindowOpacity;
+export using ::glfwIconifyWindow;
+export using ::glfwRestoreWindow;
+export using ::glfwMaximizeWindow;
+export using ::glfwShowWindow;
+export using ::glfwHideWindow;
+export using ::glfwFocusWindow;
+export using ::glfwRequestWindowAttention;
+export using ::glfwGetWindowMonitor;
+export using ::glfwSetWindowMonitor;
+export using ::glfwGetWindowAttrib;
+export using ::glfwSetWindowAttrib;
+export using ::glfwSetWindowUserPointer;
+export using ::glfwGetWindowUserPointer;
+export using ::glfwSetWindowPosCallback;
+export using ::glfwSetWindowSizeCallback;
+export using ::glfwSetWindowCloseCallback;
+export using ::glfwSetWindowRefreshCallback;
+export using ::glfwSetWindowFocusCallback;
+export using ::glfwSetWindowIconifyCallback;
+export using ::glfwSetWindowMaximizeCallback;
+export using ::glfwSetFramebufferSizeCallback;
+export using ::glfwSetWindowContentScaleCallback;
+export using ::glfwPollEvents;
+export using ::glfwWaitEvents;
+export using ::glfwWaitEventsTimeout;
+export using ::glfwPostEmptyEvent;
+export using ::glfwGetInputMode;
+export using ::glfwSetInputMode;
+export using ::glfwRawMouseMotionSupported;
+export using ::glfwGetKeyName;
+export using ::glfwGetKeyScancode;
+export using ::glfwGetKey;
+export using ::glfwGetMouseButton;
+export using ::glfwGetCursorPos;
+export using ::glfwSetCursorPos;
+export using ::glfwCreateCursor;
+export using ::glfwCreateStandardCursor;
+export using ::glfwDestroyCursor;
+export using ::glfwSetCursor;
+export using ::glfwSetKeyCallback;
+export using ::glfwSetCharCallback;
+export using ::glfwSetCharModsCallback;
+export using ::glfwSetMouseButtonCallback;
+export using ::glfwSetCursorPosCallback;
+export using ::glfwSetCursorEnterCallback;
+export using ::glfwSetScrollCallback;
+export using ::glfwSetDropCallback;
+export using ::glfwJoystickPresent;
+export using ::glfwGetJoystickAxes;
+export using ::glfwGetJoystickButtons;
+export using ::glfwGetJoystickHats;
+export using ::glfwGetJoystickName;
+export using ::glfwGetJoystickGUID;
+export using ::glfwSetJoystickUserPointer;
+export using ::glfwGetJoystickUserPointer;
+export using ::glfwJoystickIsGamepad;
+export using ::glfwSetJoystickCallback;
+export using ::glfwUpdateGamepadMappings;
+export using ::glfwGetGamepadName;
+export using ::glfwGetGamepadState;
+export using ::glfwSetClipboardString;
+export using ::glfwGetClipboardString;
+export using ::glfwGetTime;
+export using ::glfwSetTime;
+export using ::glfwGetTimerValue;
+export using ::glfwGetTimerFrequency;
+export using ::glfwMakeContextCurrent;
+export using ::glfwGetCurrentContext;
+export using ::glfwSwapBuffers;
+export using ::glfwSwapInterval;
+export using ::glfwExtensionSupported;
+export using ::glfwGetProcAddress;
+export using ::glfwVulkanSupported;
+export using ::glfwGetRequiredInstanceExtensions;
+#ifdef VK_VERSION_1_0
+export using ::glfwGetInstanceProcAddress;
+#endif // VK_VERSION_1_0
+#ifdef VK_VERSION_1_0
+export using ::glfwGetPhysicalDevicePresentationSupport;
+#endif // VK_VERSION_1_0
+#ifdef VK_VERSION_1_0
+export using ::glfwCreateWindowSurface;
+#endif // VK_VERSION_1_0
+#ifdef _glfw3_webgpu_h_
+export using ::glfwGetWGPUSurface;
+#endif // _glfw3_webgpu_h_
+#undef GLFW_VERSION_MAJOR
+export constexpr int GLFW_VERSION_MAJOR = 3;
+#undef GLFW_VERSION_MINOR
+export constexpr int GLFW_VERSION_MINOR = 4;
+#undef GLFW_VERSION_REVISION
+export constexpr int GLFW_VERSION_REVISION = 0;
+#undef GLFW_TRUE
+export constexpr int GLFW_TRUE = 1;
+#undef GLFW_FALSE
+export constexpr int GLFW_FALSE = 0;
+#undef GLFW_RELEASE
+export constexpr int GLFW_RELEASE = 0;
+#undef GLFW_PRESS
+export constexpr int GLFW_PRESS = 1;
+#undef GLFW_REPEAT
+export constexpr int GLFW_REPEAT = 2;
+#undef GLFW_HAT_CENTERED
+export constexpr int GLFW_HAT_CENTERED = 0;
+#undef GLFW_HAT_UP
+export constexpr int GLFW_HAT_UP = 1;
+#undef GLFW_HAT_RIGHT
+export constexpr int GLFW_HAT_RIGHT = 2;
+#undef GLFW_HAT_DOWN
+export constexpr int GLFW_HAT_DOWN = 4;
+#undef GLFW_HAT_LEFT
+export constexpr int GLFW_HAT_LEFT = 8;
+#undef GLFW_HAT_RIGHT_UP
+export constexpr int GLFW_HAT_RIGHT_UP = 3;
+#undef GLFW_HAT_RIGHT_DOWN
+export constexpr int GLFW_HAT_RIGHT_DOWN = 6;
+#undef GLFW_HAT_LEFT_UP
+export constexpr int GLFW_HAT_LEFT_UP = 9;
+#undef GLFW_HAT_LEFT_DOWN
+export constexpr int GLFW_HAT_LEFT_DOWN = 12;
+#undef GLFW_KEY_UNKNOWN
+export constexpr int GLFW_KEY_UNKNOWN = -1;
+#undef GLFW_KEY_SPACE
+export constexpr int GLFW_KEY_SPACE = 32;
+#undef GLFW_KEY_APOSTROPHE
+export constexpr int GLFW_KEY_APOSTROPHE = 39;
+#undef GLFW_KEY_COMMA
+export constexpr int GLFW_KEY_COMMA = 44;
+#undef GLFW_KEY_MINUS
+export constexpr int GLFW_KEY_MINUS = 45;
+#undef GLFW_KEY_PERIOD
+export constexpr int GLFW_KEY_PERIOD = 46;
+#undef GLFW_KEY_SLASH
+export constexpr int GLFW_KEY_SLASH = 47;
+#undef GLFW_KEY_0
+export constexpr int GLFW_KEY_0 = 48;
+#undef GLFW_KEY_1
+export constexpr int GLFW_KEY_1 = 49;
+#undef GLFW_KEY_2
+export constexpr int GLFW_KEY_2 = 50;
+#undef GLFW_KEY_3
+export constexpr int GLFW_KEY_3 = 51;
+#undef GLFW_KEY_4
+export constexpr int GLFW_KEY_4 = 52;
+#undef GLFW_KEY_5
+export constexpr int GLFW_KEY_5 = 53;
+#undef GLFW_KEY_6
+export constexpr int GLFW_KEY_6 = 54;
+#undef GLFW_KEY_7
+export constexpr int GLFW_KEY_7 = 55;
+#undef GLFW_KEY_8
+export constexpr int GLFW_KEY_8 = 56;
+#undef GLFW_KEY_9
+export constexpr int GLFW_KEY_9 = 57;
+#undef GLFW_KEY_SEMICOLON
+export constexpr int GLFW_KEY_SEMICOLON = 59;
+#undef GLFW_KEY_EQUAL
+export constexpr int GLFW_KEY_EQUAL = 61;
+#undef GLFW_KEY_A
+export constexpr int GLFW_KEY_A = 65;
+#undef GLFW_KEY_B
+export constexpr int GLFW_KEY_B = 66;
+#undef GLFW_KEY_C
+export constexpr int GLFW_KEY_C = 67;
+#undef GLFW_KEY_D
+export constexpr int GLFW_KEY_D = 68;
+#undef GLFW_KEY_E
+export constexpr int GLFW_KEY_E = 69;
+#undef GLFW_KEY_F
+export constexpr int GLFW_KEY_F = 70;
+#undef GLFW_KEY_G
+export constexpr int GLFW_KEY_G = 71;
+#undef GLFW_KEY_H
+export constexpr int GLFW_KEY_H = 72;
+#undef GLFW_KEY_I
+export constexpr int GLFW_KEY_I = 73;
+#undef GLFW_KEY_J
+export constexpr int GLFW_KEY_J = 74;
+#undef GLFW_KEY_K
+export constexpr int GLFW_KEY_K = 75;
+#undef GLFW_KEY_L
+export constexpr int GLFW_KEY_L = 76;
+#undef GLFW_KEY_M
+export constexpr int GLFW_KEY_M = 77;
+#undef GLFW_KEY_N
+export constexpr int GLFW_KEY_N = 78;
+#undef GLFW_KEY_O
+export constexpr int GLFW_KEY_O = 79;
+#undef GLFW_KEY_P
+export constexpr int GLFW_KEY_P = 80;
+#undef GLFW_KEY_Q
+export constexpr int GLFW_KEY_Q = 81;
+#undef GLFW_KEY_R
+export constexpr int GLFW_KEY_R = 82;
+#undef GLFW_KEY_S
+export constexpr int GLFW_KEY_S = 83;
+#undef GLFW_KEY_T
+export constexpr int GLFW_KEY_T = 84;
+#undef GLFW_KEY_U
+export constexpr int GLFW_KEY_U = 85;
+#undef GLFW_KEY_V
+export constexpr int GLFW_KEY_V = 86;
+#undef GLFW_KEY_W
+export constexpr int GLFW_KEY_W = 87;
+#undef GLFW_KEY_X
+export constexpr int GLFW_KEY_X = 88;
+#undef GLFW_KEY_Y
+export constexpr int GLFW_KEY_Y = 89;
+#undef GLFW_KEY_Z
+export constexpr int GLFW_KEY_Z = 90;
+#undef GLFW_KEY_LEFT_BRACKET
+export constexpr int GLFW_KEY_LEFT_BRACKET = 91;
+#undef GLFW_KEY_BACKSLASH
+export constexpr int GLFW_KEY_BACKSLASH = 92;
+#undef GLFW_KEY_RIGHT_BRACKET
+export constexpr int GLFW_KEY_RIGHT_BRACKET = 93;
+#undef GLFW_KEY_GRAVE_ACCENT
+export constexpr int GLFW_KEY_GRAVE_ACCENT = 96;
+#undef GLFW_KEY_WORLD_1
+export constexpr int GLFW_KEY_WORLD_1 = 161;
+#undef GLFW_KEY_WORLD_2
+export constexpr int GLFW_KEY_WORLD_2 = 162;
+#undef GLFW_KEY_ESCAPE
+export constexpr int GLFW_KEY_ESCAPE = 256;
+#undef GLFW_KEY_ENTER
+export constexpr int GLFW_KEY_ENTER = 257;
+#undef GLFW_KEY_TAB
+export constexpr int GLFW_KEY_TAB = 258;
+#undef GLFW_KEY_BACKSPACE
+export constexpr int GLFW_KEY_BACKSPACE = 259;
+#undef GLFW_KEY_INSERT
+export constexpr int GLFW_KEY_INSERT = 260;
+#undef GLFW_KEY_DELETE
+export constexpr int GLFW_KEY_DELETE = 261;
+#undef GLFW_KEY_RIGHT
+export constexpr int GLFW_KEY_RIGHT = 262;
+#undef GLFW_KEY_LEFT
+export constexpr int GLFW_KEY_LEFT = 263;
+#undef GLFW_KEY_DOWN
+export constexpr int GLFW_KEY_DOWN = 264;
+#undef GLFW_KEY_UP
+export constexpr int GLFW_KEY_UP = 265;
+#undef GLFW_KEY_PAGE_UP
+export constexpr int GLFW_KEY_PAGE_UP = 266;
+#undef GLFW_KEY_PAGE_DOWN
+export constexpr int GLFW_KEY_PAGE_DOWN = 267;
+#undef GLFW_KEY_HOME
+export constexpr int GLFW_KEY_HOME = 268;
+#undef GLFW_KEY_END
+export constexpr int GLFW_KEY_END = 269;
+#undef GLFW_KEY_CAPS_LOCK
+export constexpr int GLFW_KEY_CAPS_LOCK = 280;
+#undef GLFW_KEY_SCROLL_LOCK
+export constexpr int GLFW_KEY_SCROLL_LOCK = 281;
+#undef GLFW_KEY_NUM_LOCK
+export constexpr int GLFW_KEY_NUM_LOCK = 282;
+#undef GLFW_KEY_PRINT_SCREEN
+export constexpr int GLFW_KEY_PRINT_SCREEN = 283;
+#undef GLFW_KEY_PAUSE
+export constexpr int GLFW_KEY_PAUSE = 284;
+#undef GLFW_KEY_F1
+export constexpr int GLFW_KEY_F1 = 290;
+#undef GLFW_KEY_F2
+export constexpr int GLFW_KEY_F2 = 291;
+#undef GLFW_KEY_F3
+export constexpr int GLFW_KEY_F3 = 292;
+#undef GLFW_KEY_F4
+export constexpr int GLFW_KEY_F4 = 293;
+#undef GLFW_KEY_F5
+export constexpr int GLFW_KEY_F5 = 294;
+#undef GLFW_KEY_F6
+export constexpr int GLFW_KEY_F6 = 295;
+#undef GLFW_KEY_F7
+export constexpr int GLFW_KEY_F7 = 296;
+#undef GLFW_KEY_F8
+export constexpr int GLFW_KEY_F8 = 297;
+#undef GLFW_KEY_F9
+export constexpr int GLFW_KEY_F9 = 298;
+#undef GLFW_KEY_F10
+export constexpr int GLFW_KEY_F10 = 299;
+#undef GLFW_KEY_F11
+export constexpr int GLFW_KEY_F11 = 300;
+#undef GLFW_KEY_F12
+export constexpr int GLFW_KEY_F12 = 301;
+#undef GLFW_KEY_F13
+export constexpr int GLFW_KEY_F13 = 302;
+#undef GLFW_KEY_F14
+export constexpr int GLFW_KEY_F14 = 303;
+#undef GLFW_KEY_F15
+export constexpr int GLFW_KEY_F15 = 304;
+#undef GLFW_KEY_F16
+export constexpr int GLFW_KEY_F16 = 305;
+#undef GLFW_KEY_F17
+export constexpr int GLFW_KEY_F17 = 306;
+#undef GLFW_KEY_F18
+export constexpr int GLFW_KEY_F18 = 307;
+#undef GLFW_KEY_F19
+export constexpr int GLFW_KEY_F19 = 308;
+#undef GLFW_KEY_F20
+export constexpr int GLFW_KEY_F20 = 309;
+#undef GLFW_KEY_F21
+export constexpr int GLFW_KEY_F21 = 310;
+#undef GLFW_KEY_F22
+export constexpr int GLFW_KEY_F22 = 311;
+#undef GLFW_KEY_F23
+export constexpr int GLFW_KEY_F23 = 312;
+#undef GLFW_KEY_F24
+export constexpr int GLFW_KEY_F24 = 313;
+#undef GLFW_KEY_F25
+export constexpr int GLFW_KEY_F25 = 314;
+#undef GLFW_KEY_KP_0
+export constexpr int GLFW_KEY_KP_0 = 320;
+#undef GLFW_KEY_KP_1
+export constexpr int GLFW_KEY_KP_1 = 321;
+#undef GLFW_KEY_KP_2
+export constexpr int GLFW_KEY_KP_2 = 322;
+#undef GLFW_KEY_KP_3
+export constexpr int GLFW_KEY_KP_3 = 323;
+#undef GLFW_KEY_KP_4
+export constexpr int GLFW_KEY_KP_4 = 324;
+#undef GLFW_KEY_KP_5
+export constexpr int GLFW_KEY_KP_5 = 325;
+#undef GLFW_KEY_KP_6
+export constexpr int GLFW_KEY_KP_6 = 326;
+#undef GLFW_KEY_KP_7
+export constexpr int GLFW_KEY_KP_7 = 327;
+#undef GLFW_KEY_KP_8
+export constexpr int GLFW_KEY_KP_8 = 328;
+#undef GLFW_KEY_KP_9
+export constexpr int GLFW_KEY_KP_9 = 329;
+#undef GLFW_KEY_KP_DECIMAL
+export constexpr int GLFW_KEY_KP_DECIMAL = 330;
+#undef GLFW_KEY_KP_DIVIDE
+export constexpr int GLFW_KEY_KP_DIVIDE = 331;
+#undef GLFW_KEY_KP_MULTIPLY
+export constexpr int GLFW_KEY_KP_MULTIPLY = 332;
+#undef GLFW_KEY_KP_SUBTRACT
+export constexpr int GLFW_KEY_KP_SUBTRACT = 333;
+#undef GLFW_KEY_KP_ADD
+export constexpr int GLFW_KEY_KP_ADD = 334;
+#undef GLFW_KEY_KP_ENTER
+export constexpr int GLFW_KEY_KP_ENTER = 335;
+#undef GLFW_KEY_KP_EQUAL
+export constexpr int GLFW_KEY_KP_EQUAL = 336;
+#undef GLFW_KEY_LEFT_SHIFT
+export constexpr int GLFW_KEY_LEFT_SHIFT = 340;
+#undef GLFW_KEY_LEFT_CONTROL
+export constexpr int GLFW_KEY_LEFT_CONTROL = 341;
+#undef GLFW_KEY_LEFT_ALT
+export constexpr int GLFW_KEY_LEFT_ALT = 342;
+#undef GLFW_KEY_LEFT_SUPER
+export constexpr int GLFW_KEY_LEFT_SUPER = 343;
+#undef GLFW_KEY_RIGHT_SHIFT
+export constexpr int GLFW_KEY_RIGHT_SHIFT = 344;
+#undef GLFW_KEY_RIGHT_CONTROL
+export constexpr int GLFW_KEY_RIGHT_CONTROL = 345;
+#undef GLFW_KEY_RIGHT_ALT
+export constexpr int GLFW_KEY_RIGHT_ALT = 346;
+#undef GLFW_KEY_RIGHT_SUPER
+export constexpr int GLFW_KEY_RIGHT_SUPER = 347;
+#undef GLFW_KEY_MENU
+export constexpr int GLFW_KEY_MENU = 348;
+#undef GLFW_KEY_LAST
+export constexpr int GLFW_KEY_LAST = 348;
+#undef GLFW_MOD_SHIFT
+export constexpr int GLFW_MOD_SHIFT = 1;
+#undef GLFW_MOD_CONTROL
+export constexpr int GLFW_MOD_CONTROL = 2;
+#undef GLFW_MOD_ALT
+export constexpr int GLFW_MOD_ALT = 4;
+#undef GLFW_MOD_SUPER
+export constexpr int GLFW_MOD_SUPER = 8;
+#undef GLFW_MOD_CAPS_LOCK
+export constexpr int GLFW_MOD_CAPS_LOCK = 16;
+#undef GLFW_MOD_NUM_LOCK
+export constexpr int GLFW_MOD_NUM_LOCK = 32;
+#undef GLFW_MOUSE_BUTTON_1
+export constexpr int GLFW_MOUSE_BUTTON_1 = 0;
+#undef GLFW_MOUSE_BUTTON_2
+export constexpr int GLFW_MOUSE_BUTTON_2 = 1;
+#undef GLFW_MOUSE_BUTTON_3
+export constexpr int GLFW_MOUSE_BUTTON_3 = 2;
+#undef GLFW_MOUSE_BUTTON_4
+export constexpr int GLFW_MOUSE_BUTTON_4 = 3;
+#undef GLFW_MOUSE_BUTTON_5
+export constexpr int GLFW_MOUSE_BUTTON_5 = 4;
+#undef GLFW_MOUSE_BUTTON_6
+export constexpr int GLFW_MOUSE_BUTTON_6 = 5;
+#undef GLFW_MOUSE_BUTTON_7
+export constexpr int GLFW_MOUSE_BUTTON_7 = 6;
+#undef GLFW_MOUSE_BUTTON_8
+export constexpr int GLFW_MOUSE_BUTTON_8 = 7;
+#undef GLFW_MOUSE_BUTTON_LAST
+export constexpr int GLFW_MOUSE_BUTTON_LAST = 7;
+#undef GLFW_MOUSE_BUTTON_LEFT
+export constexpr int GLFW_MOUSE_BUTTON_LEFT = 0;
+#undef GLFW_MOUSE_BUTTON_RIGHT
+export constexpr int GLFW_MOUSE_BUTTON_RIGHT = 1;
+#undef GLFW_MOUSE_BUTTON_MIDDLE
+export constexpr int GLFW_MOUSE_BUTTON_MIDDLE = 2;
+#undef GLFW_JOYSTICK_1
+export constexpr int GLFW_JOYSTICK_1 = 0;
+#undef GLFW_JOYSTICK_2
+export constexpr int GLFW_JOYSTICK_2 = 1;
+#undef GLFW_JOYSTICK_3
+export constexpr int GLFW_JOYSTICK_3 = 2;
+#undef GLFW_JOYSTICK_4
+export constexpr int GLFW_JOYSTICK_4 = 3;
+#undef GLFW_JOYSTICK_5
+export constexpr int GLFW_JOYSTICK_5 = 4;
+#undef GLFW_JOYSTICK_6
+export constexpr int GLFW_JOYSTICK_6 = 5;
+#undef GLFW_JOYSTICK_7
+export constexpr int GLFW_JOYSTICK_7 = 6;
+#undef GLFW_JOYSTICK_8
+export constexpr int GLFW_JOYSTICK_8 = 7;
+#undef GLFW_JOYSTICK_9
+export constexpr int GLFW_JOYSTICK_9 = 8;
+#undef GLFW_JOYSTICK_10
+export constexpr int GLFW_JOYSTICK_10 = 9;
+#undef GLFW_JOYSTICK_11
+export constexpr int GLFW_JOYSTICK_11 = 10;
+#undef GLFW_JOYSTICK_12
+export constexpr int GLFW_JOYSTICK_12 = 11;
+#undef GLFW_JOYSTICK_13
+export constexpr int GLFW_JOYSTICK_13 = 12;
+#undef GLFW_JOYSTICK_14
+export constexpr int GLFW_JOYSTICK_14 = 13;
+#undef GLFW_JOYSTICK_15
+export constexpr int GLFW_JOYSTICK_15 = 14;
+#undef GLFW_JOYSTICK_16
+export constexpr int GLFW_JOYSTICK_16 = 15;
+#undef GLFW_JOYSTICK_LAST
+export constexpr int GLFW_JOYSTICK_LAST = 15;
+#undef GLFW_GAMEPAD_BUTTON_A
+export constexpr int GLFW_GAMEPAD_BUTTON_A = 0;
+#undef GLFW_GAMEPAD_BUTTON_B
+export constexpr int GLFW_GAMEPAD_BUTTON_B = 1;
+#undef GLFW_GAMEPAD_BUTTON_X
+export constexpr int GLFW_GAMEPAD_BUTTON_X = 2;
+#undef GLFW_GAMEPAD_BUTTON_Y
+export constexpr int GLFW_GAMEPAD_BUTTON_Y = 3;
+#undef GLFW_GAMEPAD_BUTTON_LEFT_BUMPER
+export constexpr int GLFW_GAMEPAD_BUTTON_LEFT_BUMPER = 4;
+#undef GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER
+export constexpr int GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER = 5;
+#undef GLFW_GAMEPAD_BUTTON_BACK
+export constexpr int GLFW_GAMEPAD_BUTTON_BACK = 6;
+#undef GLFW_GAMEPAD_BUTTON_START
+export constexpr int GLFW_GAMEPAD_BUTTON_START = 7;
+#undef GLFW_GAMEPAD_BUTTON_GUIDE
+export constexpr int GLFW_GAMEPAD_BUTTON_GUIDE = 8;
+#undef GLFW_GAMEPAD_BUTTON_LEFT_THUMB
+export constexpr int GLFW_GAMEPAD_BUTTON_LEFT_THUMB = 9;
+#undef GLFW_GAMEPAD_BUTTON_RIGHT_THUMB
+export constexpr int GLFW_GAMEPAD_BUTTON_RIGHT_THUMB = 10;
+#undef GLFW_GAMEPAD_BUTTON_DPAD_UP
+export constexpr int GLFW_GAMEPAD_BUTTON_DPAD_UP = 11;
+#undef GLFW_GAMEPAD_BUTTON_DPAD_RIGHT
+export constexpr int GLFW_GAMEPAD_BUTTON_DPAD_RIGHT = 12;
+#undef GLFW_GAMEPAD_BUTTON_DPAD_DOWN
+export constexpr int GLFW_GAMEPAD_BUTTON_DPAD_DOWN = 13;
+#undef GLFW_GAMEPAD_BUTTON_DPAD_LEFT
+export constexpr int GLFW_GAMEPAD_BUTTON_DPAD_LEFT = 14;
+#undef GLFW_GAMEPAD_BUTTON_LAST
+export constexpr int GLFW_GAMEPAD_BUTTON_LAST = 14;
+#undef GLFW_GAMEPAD_BUTTON_CROSS
+export constexpr int GLFW_GAMEPAD_BUTTON_CROSS = 0;
+#undef GLFW_GAMEPAD_BUTTON_CIRCLE
+export constexpr int GLFW_GAMEPAD_BUTTON_CIRCLE = 1;
+#undef GLFW_GAMEPAD_BUTTON_SQUARE
+export constexpr int GLFW_GAMEPAD_BUTTON_SQUARE = 2;
+#undef GLFW_GAMEPAD_BUTTON_TRIANGLE
+export constexpr int GLFW_GAMEPAD_BUTTON_TRIANGLE = 3;
+#undef GLFW_GAMEPAD_AXIS_LEFT_X
+export constexpr int GLFW_GAMEPAD_AXIS_LEFT_X = 0;
+#undef GLFW_GAMEPAD_AXIS_LEFT_Y
+export constexpr int GLFW_GAMEPAD_AXIS_LEFT_Y = 1;
+#undef GLFW_GAMEPAD_AXIS_RIGHT_X
+export constexpr int GLFW_GAMEPAD_AXIS_RIGHT_X = 2;
+#undef GLFW_GAMEPAD_AXIS_RIGHT_Y
+export constexpr int GLFW_GAMEPAD_AXIS_RIGHT_Y = 3;
+#undef GLFW_GAMEPAD_AXIS_LEFT_TRIGGER
+export constexpr int GLFW_GAMEPAD_AXIS_LEFT_TRIGGER = 4;
+#undef GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER
+export constexpr int GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER = 5;
+#undef GLFW_GAMEPAD_AXIS_LAST
+export constexpr int GLFW_GAMEPAD_AXIS_LAST = 5;
+#undef GLFW_NO_ERROR
+export constexpr int GLFW_NO_ERROR = 0;
+#undef GLFW_NOT_INITIALIZED
+export constexpr int GLFW_NOT_INITIALIZED = 65537;
+#undef GLFW_NO_CURRENT_CONTEXT
+export constexpr int GLFW_NO_CURRENT_CONTEXT = 65538;
+#undef GLFW_INVALID_ENUM
+export constexpr int GLFW_INVALID_ENUM = 65539;
+#undef GLFW_INVALID_VALUE
+export constexpr int GLFW_INVALID_VALUE = 65540;
+#undef GLFW_OUT_OF_MEMORY
+export constexpr int GLFW_OUT_OF_MEMORY = 65541;
+#undef GLFW_API_UNAVAILABLE
+export constexpr int GLFW_API_UNAVAILABLE = 65542;
+#undef GLFW_VERSION_UNAVAILABLE
+export constexpr int GLFW_VERSION_UNAVAILABLE = 65543;
+#undef GLFW_PLATFORM_ERROR
+export constexpr int GLFW_PLATFORM_ERROR = 65544;
+#undef GLFW_FORMAT_UNAVAILABLE
+export constexpr int GLFW_FORMAT_UNAVAILABLE = 65545;
+#undef GLFW_NO_WINDOW_CONTEXT
+export constexpr int GLFW_NO_WINDOW_CONTEXT = 65546;
+#undef GLFW_CURSOR_UNAVAILABLE
+export constexpr int GLFW_CURSOR_UNAVAILABLE = 65547;
+#undef GLFW_FEATURE_UNAVAILABLE
+export constexpr int GLFW_FEATURE_UNAVAILABLE = 65548;
+#undef GLFW_FEATURE_UNIMPLEMENTED
+export constexpr int GLFW_FEATURE_UNIMPLEMENTED = 65549;
+#undef GLFW_PLATFORM_UNAVAILABLE
+export constexpr int GLFW_PLATFORM_UNAVAILABLE = 65550;
+#undef GLFW_FOCUSED
+export constexpr int GLFW_FOCUSED = 131073;
+#undef GLFW_ICONIFIED
+export constexpr int GLFW_ICONIFIED = 131074;
+#undef GLFW_RESIZABLE
+export constexpr int GLFW_RESIZABLE = 131075;
+#undef GLFW_VISIBLE
+export constexpr int GLFW_VISIBLE = 131076;
+#undef GLFW_DECORATED
+export constexpr int GLFW_DECORATED = 131077;
+#undef GLFW_AUTO_ICONIFY
+export constexpr int GLFW_AUTO_ICONIFY = 131078;
+#undef GLFW_FLOATING
+export constexpr int GLFW_FLOATING = 131079;
+#undef GLFW_MAXIMIZED
+export constexpr int GLFW_MAXIMIZED = 131080;
+#undef GLFW_CENTER_CURSOR
+export constexpr int GLFW_CENTER_CURSOR = 131081;
+#undef GLFW_TRANSPARENT_FRAMEBUFFER
+export constexpr int GLFW_TRANSPARENT_FRAMEBUFFER = 131082;
+#undef GLFW_HOVERED
+export constexpr int GLFW_HOVERED = 131083;
+#undef GLFW_FOCUS_ON_SHOW
+export constexpr int GLFW_FOCUS_ON_SHOW = 131084;
+#undef GLFW_MOUSE_PASSTHROUGH
+export constexpr int GLFW_MOUSE_PASSTHROUGH = 131085;
+#undef GLFW_POSITION_X
+export constexpr int GLFW_POSITION_X = 131086;
+#undef GLFW_POSITION_Y
+export constexpr int GLFW_POSITION_Y = 131087;
+#undef GLFW_RED_BITS
+export constexpr int GLFW_RED_BITS = 135169;
+#undef GLFW_GREEN_BITS
+export constexpr int GLFW_GREEN_BITS = 135170;
+#undef GLFW_BLUE_BITS
+export constexpr int GLFW_BLUE_BITS = 135171;
+#undef GLFW_ALPHA_BITS
+export constexpr int GLFW_ALPHA_BITS = 135172;
+#undef GLFW_DEPTH_BITS
+export constexpr int GLFW_DEPTH_BITS = 135173;
+#undef GLFW_STENCIL_BITS
+export constexpr int GLFW_STENCIL_BITS = 135174;
+#undef GLFW_ACCUM_RED_BITS
+export constexpr int GLFW_ACCUM_RED_BITS = 135175;
+#undef GLFW_ACCUM_GREEN_BITS
+export constexpr int GLFW_ACCUM_GREEN_BITS = 135176;
+#undef GLFW_ACCUM_BLUE_BITS
+export constexpr int GLFW_ACCUM_BLUE_BITS = 135177;
+#undef GLFW_ACCUM_ALPHA_BITS
+export constexpr int GLFW_ACCUM_ALPHA_BITS = 135178;
+#undef GLFW_AUX_BUFFERS
+export constexpr int GLFW_AUX_BUFFERS = 135179;
+#undef GLFW_STEREO
+export constexpr int GLFW_STEREO = 135180;
+#undef GLFW_SAMPLES
+export constexpr int GLFW_SAMPLES = 135181;
+#undef GLFW_SRGB_CAPABLE
+export constexpr int GLFW_SRGB_CAPABLE = 135182;
+#undef GLFW_REFRESH_RATE
+export constexpr int GLFW_REFRESH_RATE = 135183;
+#undef GLFW_DOUBLEBUFFER
+export constexpr int GLFW_DOUBLEBUFFER = 135184;
+#undef GLFW_CLIENT_API
+export constexpr int GLFW_CLIENT_API = 139265;
+#undef GLFW_CONTEXT_VERSION_MAJOR
+export constexpr int GLFW_CONTEXT_VERSION_MAJOR = 139266;
+#undef GLFW_CONTEXT_VERSION_MINOR
+export constexpr int GLFW_CONTEXT_VERSION_MINOR = 139267;
+#undef GLFW_CONTEXT_REVISION
+export constexpr int GLFW_CONTEXT_REVISION = 139268;
+#undef GLFW_CONTEXT_ROBUSTNESS
+export constexpr int GLFW_CONTEXT_ROBUSTNESS = 139269;
+#undef GLFW_OPENGL_FORWARD_COMPAT
+export constexpr int GLFW_OPENGL_FORWARD_COMPAT = 139270;
+#undef GLFW_CONTEXT_DEBUG
+export constexpr int GLFW_CONTEXT_DEBUG = 139271;
+#undef GLFW_OPENGL_DEBUG_CONTEXT
+export constexpr int GLFW_OPENGL_DEBUG_CONTEXT = 139271;
+#undef GLFW_OPENGL_PROFILE
+export constexpr int GLFW_OPENGL_PROFILE = 139272;
+#undef GLFW_CONTEXT_RELEASE_BEHAVIOR
+export constexpr int GLFW_CONTEXT_RELEASE_BEHAVIOR = 139273;
+#undef GLFW_CONTEXT_NO_ERROR
+export constexpr int GLFW_CONTEXT_NO_ERROR = 139274;
+#undef GLFW_CONTEXT_CREATION_API
+export constexpr int GLFW_CONTEXT_CREATION_API = 139275;
+#undef GLFW_SCALE_TO_MONITOR
+export constexpr int GLFW_SCALE_TO_MONITOR = 139276;
+#undef GLFW_SCALE_FRAMEBUFFER
+export constexpr int GLFW_SCALE_FRAMEBUFFER = 139277;
+#undef GLFW_COCOA_RETINA_FRAMEBUFFER
+export constexpr int GLFW_COCOA_RETINA_FRAMEBUFFER = 143361;
+#undef GLFW_COCOA_FRAME_NAME
+export constexpr int GLFW_COCOA_FRAME_NAME = 143362;
+#undef GLFW_COCOA_GRAPHICS_SWITCHING
+export constexpr int GLFW_COCOA_GRAPHICS_SWITCHING = 143363;
+#undef GLFW_X11_CLASS_NAME
+export constexpr int GLFW_X11_CLASS_NAME = 147457;
+#undef GLFW_X11_INSTANCE_NAME
+export constexpr int GLFW_X11_INSTANCE_NAME = 147458;
+#undef GLFW_WIN32_KEYBOARD_MENU
+export constexpr int GLFW_WIN32_KEYBOARD_MENU = 151553;
+#undef GLFW_WIN32_SHOWDEFAULT
+export constexpr int GLFW_WIN32_SHOWDEFAULT = 151554;
+#undef GLFW_WAYLAND_APP_ID
+export constexpr int GLFW_WAYLAND_APP_ID = 155649;
+#undef GLFW_NO_API
+export constexpr int GLFW_NO_API = 0;
+#undef GLFW_OPENGL_API
+export constexpr int GLFW_OPENGL_API = 196609;
+#undef GLFW_OPENGL_ES_API
+export constexpr int GLFW_OPENGL_ES_API = 196610;
+#undef GLFW_NO_ROBUSTNESS
+export constexpr int GLFW_NO_ROBUSTNESS = 0;
+#undef GLFW_NO_RESET_NOTIFICATION
+export constexpr int GLFW_NO_RESET_NOTIFICATION = 200705;
+#undef GLFW_LOSE_CONTEXT_ON_RESET
+export constexpr int GLFW_LOSE_CONTEXT_ON_RESET = 200706;
+#undef GLFW_OPENGL_ANY_PROFILE
+export constexpr int GLFW_OPENGL_ANY_PROFILE = 0;
+#undef GLFW_OPENGL_CORE_PROFILE
+export constexpr int GLFW_OPENGL_CORE_PROFILE = 204801;
+#undef GLFW_OPENGL_COMPAT_PROFILE
+export constexpr int GLFW_OPENGL_COMPAT_PROFILE = 204802;
+#undef GLFW_CURSOR
+export constexpr int GLFW_CURSOR = 208897;
+#undef GLFW_STICKY_KEYS
+export constexpr int GLFW_STICKY_KEYS = 208898;
+#undef GLFW_STICKY_MOUSE_BUTTONS
+export constexpr int GLFW_STICKY_MOUSE_BUTTONS = 208899;
+#undef GLFW_LOCK_KEY_MODS
+export constexpr int GLFW_LOCK_KEY_MODS = 208900;
+#undef GLFW_RAW_MOUSE_MOTION
+export constexpr int GLFW_RAW_MOUSE_MOTION = 208901;
+#undef GLFW_CURSOR_NORMAL
+export constexpr int GLFW_CURSOR_NORMAL = 212993;
+#undef GLFW_CURSOR_HIDDEN
+export constexpr int GLFW_CURSOR_HIDDEN = 212994;
+#undef GLFW_CURSOR_DISABLED
+export constexpr int GLFW_CURSOR_DISABLED = 212995;
+#undef GLFW_CURSOR_CAPTURED
+export constexpr int GLFW_CURSOR_CAPTURED = 212996;
+#undef GLFW_ANY_RELEASE_BEHAVIOR
+export constexpr int GLFW_ANY_RELEASE_BEHAVIOR = 0;
+#undef GLFW_RELEASE_BEHAVIOR_FLUSH
+export constexpr int GLFW_RELEASE_BEHAVIOR_FLUSH = 217089;
+#undef GLFW_RELEASE_BEHAVIOR_NONE
+export constexpr int GLFW_RELEASE_BEHAVIOR_NONE = 217090;
+#undef GLFW_NATIVE_CONTEXT_API
+export constexpr int GLFW_NATIVE_CONTEXT_API = 221185;
+#undef GLFW_EGL_CONTEXT_API
+export constexpr int GLFW_EGL_CONTEXT_API = 221186;
+#undef GLFW_OSMESA_CONTEXT_API
+export constexpr int GLFW_OSMESA_CONTEXT_API = 221187;
+#undef GLFW_ANGLE_PLATFORM_TYPE_NONE
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_NONE = 225281;
+#undef GLFW_ANGLE_PLATFORM_TYPE_OPENGL
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_OPENGL = 225282;
+#undef GLFW_ANGLE_PLATFORM_TYPE_OPENGLES
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_OPENGLES = 225283;
+#undef GLFW_ANGLE_PLATFORM_TYPE_D3D9
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_D3D9 = 225284;
+#undef GLFW_ANGLE_PLATFORM_TYPE_D3D11
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_D3D11 = 225285;
+#undef GLFW_ANGLE_PLATFORM_TYPE_VULKAN
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_VULKAN = 225287;
+#undef GLFW_ANGLE_PLATFORM_TYPE_METAL
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE_METAL = 225288;
+#undef GLFW_WAYLAND_PREFER_LIBDECOR
+export constexpr int GLFW_WAYLAND_PREFER_LIBDECOR = 229377;
+#undef GLFW_WAYLAND_DISABLE_LIBDECOR
+export constexpr int GLFW_WAYLAND_DISABLE_LIBDECOR = 229378;
+#undef GLFW_ANY_POSITION
+export constexpr int GLFW_ANY_POSITION = -2147483648;
+#undef GLFW_ARROW_CURSOR
+export constexpr int GLFW_ARROW_CURSOR = 221185;
+#undef GLFW_IBEAM_CURSOR
+export constexpr int GLFW_IBEAM_CURSOR = 221186;
+#undef GLFW_CROSSHAIR_CURSOR
+export constexpr int GLFW_CROSSHAIR_CURSOR = 221187;
+#undef GLFW_POINTING_HAND_CURSOR
+export constexpr int GLFW_POINTING_HAND_CURSOR = 221188;
+#undef GLFW_RESIZE_EW_CURSOR
+export constexpr int GLFW_RESIZE_EW_CURSOR = 221189;
+#undef GLFW_RESIZE_NS_CURSOR
+export constexpr int GLFW_RESIZE_NS_CURSOR = 221190;
+#undef GLFW_RESIZE_NWSE_CURSOR
+export constexpr int GLFW_RESIZE_NWSE_CURSOR = 221191;
+#undef GLFW_RESIZE_NESW_CURSOR
+export constexpr int GLFW_RESIZE_NESW_CURSOR = 221192;
+#undef GLFW_RESIZE_ALL_CURSOR
+export constexpr int GLFW_RESIZE_ALL_CURSOR = 221193;
+#undef GLFW_NOT_ALLOWED_CURSOR
+export constexpr int GLFW_NOT_ALLOWED_CURSOR = 221194;
+#undef GLFW_HRESIZE_CURSOR
+export constexpr int GLFW_HRESIZE_CURSOR = 221189;
+#undef GLFW_VRESIZE_CURSOR
+export constexpr int GLFW_VRESIZE_CURSOR = 221190;
+#undef GLFW_HAND_CURSOR
+export constexpr int GLFW_HAND_CURSOR = 221188;
+#undef GLFW_CONNECTED
+export constexpr int GLFW_CONNECTED = 262145;
+#undef GLFW_DISCONNECTED
+export constexpr int GLFW_DISCONNECTED = 262146;
+#undef GLFW_JOYSTICK_HAT_BUTTONS
+export constexpr int GLFW_JOYSTICK_HAT_BUTTONS = 327681;
+#undef GLFW_ANGLE_PLATFORM_TYPE
+export constexpr int GLFW_ANGLE_PLATFORM_TYPE = 327682;
+#undef GLFW_PLATFORM
+export constexpr int GLFW_PLATFORM = 327683;
+#undef GLFW_COCOA_CHDIR_RESOURCES
+export constexpr int GLFW_COCOA_CHDIR_RESOURCES = 331777;
+#undef GLFW_COCOA_MENUBAR
+export constexpr int GLFW_COCOA_MENUBAR = 331778;
+#undef GLFW_X11_XCB_VULKAN_SURFACE
+export constexpr int GLFW_X11_XCB_VULKAN_SURFACE = 335873;
+#undef GLFW_WAYLAND_LIBDECOR
+export constexpr int GLFW_WAYLAND_LIBDECOR = 339969;
+#undef GLFW_ANY_PLATFORM
+export constexpr int GLFW_ANY_PLATFORM = 393216;
+#undef GLFW_PLATFORM_WIN32
+export constexpr int GLFW_PLATFORM_WIN32 = 393217;
+#undef GLFW_PLATFORM_COCOA
+export constexpr int GLFW_PLATFORM_COCOA = 393218;
+#undef GLFW_PLATFORM_WAYLAND
+export constexpr int GLFW_PLATFORM_WAYLAND = 393219;
+#undef GLFW_PLATFORM_X11
+export constexpr int GLFW_PLATFORM_X11 = 393220;
+#undef GLFW_PLATFORM_NULL
+export constexpr int GLFW_PLATFORM_NULL = 393221;
+#undef GLFW_DONT_CARE
+export constexpr int GLFW_DONT_CARE = -1;
+// !end_generated
+
+#ifdef GLFW_HPP_C_API_NAMESPACE
+}
+#endif
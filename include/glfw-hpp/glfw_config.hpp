@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Macros shared by all glfw-hpp headers. Included before any declarations so that
+// module builds see it in the global module fragment.
+
+#ifndef GLFW_HPP_CONFIG_INCLUDED
+#define GLFW_HPP_CONFIG_INCLUDED
+
+#define GLFW_HPP_NODISCARD [[nodiscard]]
+
+#ifndef GLFW_HPP_NO_INCLUDE
+#include <GLFW/glfw3.h>
+#endif
+
+#ifndef GLFW_HPP_NAMESPACE
+#define GLFW_HPP_NAMESPACE glfw
+#endif
+
+#ifdef GLFW_HPP_MODULE
+#define GLFW_HPP_EXPORT export
+#define GLFW_HPP_API export
+#define GLFW_HPP_API_NODISCARD export [[nodiscard]]
+#else
+#define GLFW_HPP_EXPORT
+#define GLFW_HPP_API inline
+#define GLFW_HPP_API_NODISCARD [[nodiscard]] inline
+#endif
+
+#if defined(GLFW_HPP_ENABLE_TRACING) && !defined(GLFW_HPP_ENABLE_PROFILING)
+#define GLFW_HPP_ENABLE_PROFILING
+#endif
+
+#if !defined(GLFW_HPP_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define GLFW_HPP_SSE2
+#endif
+
+#ifndef GLFW_RELEASE_BEHAVIOR_ANY
+#define GLFW_RELEASE_BEHAVIOR_ANY GLFW_ANY_RELEASE_BEHAVIOR
+#endif
+
+#ifndef GLFW_PLATFORM_ANY
+#define GLFW_PLATFORM_ANY GLFW_ANY_PLATFORM
+#endif
+
+#endif // GLFW_HPP_CONFIG_INCLUDED
@@ -0,0 +1,585 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// OpenGL context utilities: entry point tables, worker contexts for background uploads
+// and presenting several windows per frame.
+
+#ifndef GLFW_HPP_CONTEXT_INCLUDED
+#define GLFW_HPP_CONTEXT_INCLUDED
+
+#include "./glfw.hpp"
+
+#ifndef GLFW_HPP_MODULE
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+GLFW_HPP_EXPORT struct ProcEntry {
+    const char* name = nullptr;
+    // Entry points of an extension are only loaded if the context advertises it
+    const char* extension = nullptr;
+};
+
+// Typed index of a ProcTable entry, declared next to the entry array so call sites get
+// the signature from the index instead of repeating it:
+//     constexpr glfw::Proc<void (GLFW_HPP_GLAPI*)(int, unsigned*)> kGenBuffers{0};
+//     table[kGenBuffers](1, &buffer);
+GLFW_HPP_EXPORT template <typename Fn>
+struct Proc {
+    static_assert(std::is_pointer_v<Fn> && std::is_function_v<std::remove_pointer_t<Fn>>, "Proc needs a function pointer type");
+
+    std::size_t index = 0;
+};
+
+// Table of GL entry points resolved in one pass for the current context.
+// Entries are meant to come from a `constexpr std::array<ProcEntry, N>`, with
+// entries of the same extension kept adjacent so each extension is queried once.
+// Multi-context applications keep one table per context.
+GLFW_HPP_EXPORT template <std::size_t N>
+class ProcTable {
+private:
+    const std::array<ProcEntry, N>* m_entries;
+    std::array<ProcAddress, N> m_procs{};
+    ::GLFWwindow* m_context = nullptr;
+    std::size_t m_missing = N;
+
+public:
+    // Keeps a pointer to `entries`, which must outlive the table; usually a constexpr global
+    explicit constexpr ProcTable(const std::array<ProcEntry, N>& entries) noexcept : m_entries(&entries) {}
+    ProcTable(const std::array<ProcEntry, N>&&) = delete;
+
+    // Resolves every entry for the current context and returns how many stayed unresolved
+    std::size_t load() {
+        const char* extension = nullptr;
+        bool supported = false;
+        m_missing = 0;
+        m_context = currentContext().handle();
+        GLFW_HPP_PROFILE(GetProcAddress);
+        for (std::size_t i = 0; i < N; ++i) {
+            const ProcEntry& entry = (*m_entries)[i];
+            if (entry.extension != nullptr) {
+                if (extension == nullptr || (extension != entry.extension && std::strcmp(extension, entry.extension) != 0)) {
+                    extension = entry.extension;
+                    supported = extensionSupported(extension);
+                }
+                if (!supported) {
+                    m_procs[i] = nullptr;
+                    m_missing += 1;
+                    continue;
+                }
+            }
+            m_procs[i] = ::glfwGetProcAddress(entry.name);
+            m_missing += m_procs[i] == nullptr;
+        }
+        checkError();
+        return m_missing;
+    }
+
+    GLFW_HPP_NODISCARD ProcAddress operator[](std::size_t index) const noexcept {
+        return m_procs[index];
+    }
+
+    template <typename T>
+    GLFW_HPP_NODISCARD T get(std::size_t index) const noexcept {
+        return reinterpret_cast<T>(m_procs[index]);
+    }
+
+    GLFW_HPP_NODISCARD bool isLoaded(std::size_t index) const noexcept {
+        return m_procs[index] != nullptr;
+    }
+
+    // Null if the entry is missing; check `isLoaded()` for optional entry points
+    template <typename Fn>
+    GLFW_HPP_NODISCARD Fn operator[](Proc<Fn> proc) const noexcept {
+        return reinterpret_cast<Fn>(m_procs[proc.index]);
+    }
+
+    template <typename Fn>
+    GLFW_HPP_NODISCARD bool isLoaded(Proc<Fn> proc) const noexcept {
+        return m_procs[proc.index] != nullptr;
+    }
+
+    GLFW_HPP_NODISCARD std::size_t missing() const noexcept {
+        return m_missing;
+    }
+
+    // Context the table was loaded for
+    GLFW_HPP_NODISCARD Window context() const noexcept {
+        return Window{m_context};
+    }
+};
+
+// Worker threads with hidden GL contexts shared with a main window, for background uploads.
+// The pool creates and destroys its contexts on the thread that constructs it, which must
+// be the main thread. Each worker keeps its context current for its whole lifetime.
+// After a task runs, the worker inserts a fence; `collect()` on the main thread runs the
+// task's completion once the GPU has executed the uploaded commands. Without sync objects
+// (GL 3.2, GLES 3.0 or ARB_sync) the worker calls glFinish instead.
+// A worker whose context cannot be made current fails its tasks with that error.
+// The contexts are created from default window hints plus the main window's client API,
+// version and profile, and the hints are reset to their defaults again afterwards.
+// Destroying the pool finishes queued tasks, waits for their fences and runs the
+// completions `collect()` has not run yet; exceptions from tasks and completions are dropped.
+GLFW_HPP_EXPORT class SharedContextPool {
+public:
+    using Task = std::function<void()>;
+    using Completion = std::function<void()>;
+
+private:
+    using Sync = void*;
+    using FenceSync = Sync (GLFW_HPP_GLAPI*)(unsigned, unsigned);
+    using ClientWaitSync = unsigned (GLFW_HPP_GLAPI*)(Sync, unsigned, std::uint64_t);
+    using DeleteSync = void (GLFW_HPP_GLAPI*)(Sync);
+    using Flush = void (GLFW_HPP_GLAPI*)();
+
+    static constexpr unsigned kSyncGpuCommandsComplete = 0x9117;
+    static constexpr unsigned kAlreadySignaled = 0x911A;
+    static constexpr unsigned kConditionSatisfied = 0x911C;
+    static constexpr unsigned kSyncFlushCommandsBit = 0x1;
+    static constexpr std::uint64_t kTimeoutIgnored = ~std::uint64_t{0};
+
+    struct Job {
+        Task task;
+        Completion completion;
+    };
+
+    struct Finished {
+        Sync fence = nullptr;
+        Completion completion;
+        std::exception_ptr error;
+    };
+
+    std::vector<Window> m_contexts;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::deque<Job> m_jobs;
+    std::vector<Finished> m_finished;
+    bool m_stopping = false;
+
+    std::vector<Finished> m_pending;
+    ClientWaitSync m_clientWaitSync = nullptr;
+    DeleteSync m_deleteSync = nullptr;
+    bool m_versionHasSync = false;
+
+    // glfwGetProcAddress may return non-null for functions the context does not support,
+    // so the version or extension is checked first
+    static bool versionHasSync(::GLFWwindow* context) noexcept {
+        int api = ::glfwGetWindowAttrib(context, GLFW_CLIENT_API);
+        int major = ::glfwGetWindowAttrib(context, GLFW_CONTEXT_VERSION_MAJOR);
+        int minor = ::glfwGetWindowAttrib(context, GLFW_CONTEXT_VERSION_MINOR);
+        if (api == GLFW_OPENGL_ES_API) {
+            return major >= 3;
+        }
+        return api == GLFW_OPENGL_API && (major > 3 || (major == 3 && minor >= 2));
+    }
+
+    static void defaultWindowHints() {
+        GLFW_HPP_PROFILE(DefaultWindowHints);
+        ::glfwDefaultWindowHints();
+        checkError();
+    }
+
+    // Contexts must match the main window's API, version and profile to share objects with it
+    static WindowCreateInfo contextInfo(Window main) {
+        ::GLFWwindow* handle = main.handle();
+        int api = ::glfwGetWindowAttrib(handle, GLFW_CLIENT_API);
+        int creationApi = ::glfwGetWindowAttrib(handle, GLFW_CONTEXT_CREATION_API);
+        int major = ::glfwGetWindowAttrib(handle, GLFW_CONTEXT_VERSION_MAJOR);
+        int minor = ::glfwGetWindowAttrib(handle, GLFW_CONTEXT_VERSION_MINOR);
+        int profile = ::glfwGetWindowAttrib(handle, GLFW_OPENGL_PROFILE);
+        int forwardCompat = ::glfwGetWindowAttrib(handle, GLFW_OPENGL_FORWARD_COMPAT);
+        checkError();
+
+        WindowCreateInfo info;
+        info.width = 1;
+        info.height = 1;
+        info.share = main;
+        info.visible = false;
+        info.clientApi = static_cast<WindowHintClientApi>(api);
+        info.contextCreationApi = static_cast<WindowHintContextCreationApi>(creationApi);
+        info.contextVersionMajor = major;
+        info.contextVersionMinor = minor;
+        if (api == GLFW_OPENGL_API) {
+            info.openglProfile = static_cast<WindowHintOpenglProfile>(profile);
+            info.openglForwardCompat = forwardCompat == GLFW_TRUE;
+        }
+        return info;
+    }
+
+    void run(Window context) {
+        std::exception_ptr contextError;
+        try {
+            context.makeContextCurrent();
+        } catch (...) {
+            contextError = std::current_exception();
+        }
+
+        FenceSync fenceSync = nullptr;
+        Flush flush = nullptr;
+        Flush finish = nullptr;
+        if (!contextError) {
+            if (m_versionHasSync || ::glfwExtensionSupported("GL_ARB_sync") == GLFW_TRUE) {
+                fenceSync = reinterpret_cast<FenceSync>(::glfwGetProcAddress("glFenceSync"));
+            }
+            flush = reinterpret_cast<Flush>(::glfwGetProcAddress("glFlush"));
+            finish = reinterpret_cast<Flush>(::glfwGetProcAddress("glFinish"));
+        }
+
+        while (true) {
+            Job job;
+            {
+                std::unique_lock lock{m_mutex};
+                m_wakeup.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                if (m_jobs.empty()) {
+                    break;
+                }
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+
+            Finished finished;
+            finished.completion = std::move(job.completion);
+            if (contextError) {
+                finished.error = contextError;
+            } else {
+                try {
+                    job.task();
+                } catch (...) {
+                    finished.error = std::current_exception();
+                }
+                if (fenceSync != nullptr) {
+                    finished.fence = fenceSync(kSyncGpuCommandsComplete, 0);
+                    flush();
+                } else if (finish != nullptr) {
+                    finish();
+                }
+            }
+
+            std::lock_guard lock{m_mutex};
+            m_finished.push_back(std::move(finished));
+        }
+
+        if (!contextError) {
+            ::glfwMakeContextCurrent(nullptr);
+            invalidateContextCache();
+        }
+    }
+
+    // Stops the workers once the queue is drained, waits for and deletes every outstanding
+    // fence with a pool context current, runs the remaining completions, then destroys the
+    // contexts. Also cleans up a partially constructed pool.
+    void shutdown() noexcept {
+        {
+            std::lock_guard lock{m_mutex};
+            m_stopping = true;
+        }
+        m_wakeup.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+        m_workers.clear();
+
+        for (auto& finished : m_finished) {
+            m_pending.push_back(std::move(finished));
+        }
+        m_finished.clear();
+        bool fences = std::any_of(m_pending.begin(), m_pending.end(), [](const Finished& finished) {
+            return finished.fence != nullptr;
+        });
+        if (fences && !m_contexts.empty()) {
+            ::GLFWwindow* previous = ::glfwGetCurrentContext();
+            ::glfwMakeContextCurrent(m_contexts.front().handle());
+            auto clientWaitSync = reinterpret_cast<ClientWaitSync>(::glfwGetProcAddress("glClientWaitSync"));
+            auto deleteSync = reinterpret_cast<DeleteSync>(::glfwGetProcAddress("glDeleteSync"));
+            for (auto& finished : m_pending) {
+                if (finished.fence == nullptr) {
+                    continue;
+                }
+                if (clientWaitSync != nullptr) {
+                    clientWaitSync(finished.fence, kSyncFlushCommandsBit, kTimeoutIgnored);
+                }
+                if (deleteSync != nullptr) {
+                    deleteSync(finished.fence);
+                }
+            }
+            ::glfwMakeContextCurrent(previous);
+            invalidateContextCache();
+        }
+        for (auto& finished : m_pending) {
+            if (!finished.error && finished.completion) {
+                try {
+                    finished.completion();
+                } catch (...) {
+                }
+            }
+        }
+        m_pending.clear();
+
+        for (Window& context : m_contexts) {
+            context.destroy();
+        }
+        m_contexts.clear();
+    }
+
+public:
+    SharedContextPool(Window main, std::size_t workers) {
+        m_contexts.reserve(workers);
+        m_workers.reserve(workers);
+        try {
+            WindowCreateInfo info = contextInfo(main);
+            defaultWindowHints();
+            for (std::size_t i = 0; i < workers; ++i) {
+                m_contexts.push_back(createWindow(info));
+            }
+            defaultWindowHints();
+            if (!m_contexts.empty()) {
+                m_versionHasSync = versionHasSync(m_contexts.front().handle());
+            }
+            for (Window context : m_contexts) {
+                m_workers.emplace_back([this, context] { run(context); });
+            }
+        } catch (...) {
+            ::glfwDefaultWindowHints();
+            shutdown();
+            throw;
+        }
+    }
+
+    SharedContextPool(const SharedContextPool&) = delete;
+    SharedContextPool& operator=(const SharedContextPool&) = delete;
+
+    ~SharedContextPool() {
+        shutdown();
+    }
+
+    GLFW_HPP_NODISCARD std::size_t size() const noexcept {
+        return m_contexts.size();
+    }
+
+    void submit(Task task, Completion completion = {}) {
+        {
+            std::lock_guard lock{m_mutex};
+            m_jobs.push_back({std::move(task), std::move(completion)});
+        }
+        m_wakeup.notify_one();
+    }
+
+    // Runs completions of finished tasks whose fences have signaled.
+    // Must be called with a context of the share group current, usually the main window's.
+    // Rethrows the first exception thrown by a finished task.
+    std::size_t collect() {
+        {
+            std::lock_guard lock{m_mutex};
+            for (auto& finished : m_finished) {
+                m_pending.push_back(std::move(finished));
+            }
+            m_finished.clear();
+        }
+        if (m_pending.empty()) {
+            return 0;
+        }
+        if (m_clientWaitSync == nullptr) {
+            m_clientWaitSync = reinterpret_cast<ClientWaitSync>(::glfwGetProcAddress("glClientWaitSync"));
+            m_deleteSync = reinterpret_cast<DeleteSync>(::glfwGetProcAddress("glDeleteSync"));
+        }
+
+        std::size_t completed = 0;
+        std::exception_ptr error;
+        auto it = m_pending.begin();
+        while (it != m_pending.end()) {
+            if (it->fence != nullptr && m_clientWaitSync != nullptr) {
+                unsigned status = m_clientWaitSync(it->fence, 0, 0);
+                if (status != kAlreadySignaled && status != kConditionSatisfied) {
+                    ++it;
+                    continue;
+                }
+                if (m_deleteSync != nullptr) {
+                    m_deleteSync(it->fence);
+                }
+            }
+            Finished finished = std::move(*it);
+            it = m_pending.erase(it);
+            completed += 1;
+            if (finished.error) {
+                if (!error) {
+                    error = finished.error;
+                }
+            } else if (finished.completion) {
+                finished.completion();
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return completed;
+    }
+};
+
+GLFW_HPP_EXPORT struct PresentTiming {
+    Window window;
+    bool vsync = true;
+    // Swap interval the window presented with in the last frame
+    int interval = 0;
+    // Time spent in `swapBuffers()` and the moment it returned, in seconds
+    double swapTime = 0.0;
+    double presentedAt = 0.0;
+    // Time between the last two presents of this window, in seconds
+    double frameTime = 0.0;
+};
+
+// Presents a set of windows so that a frame waits for vsync at most once.
+// Swapping N windows with `swapInterval(1)` serializes N vsync waits and divides
+// the frame rate by N. The scheduler swaps every window with interval 0 first and
+// the last vsync window with interval 1, so that single swap paces the whole frame.
+// Every other window presents unsynchronized and may tear; give windows where that
+// matters their own scheduler or present them separately.
+// Swap intervals are cached per window and only set when they change.
+// The previously current context, or none, is restored after `present()`.
+GLFW_HPP_EXPORT class PresentScheduler {
+private:
+    struct Entry {
+        PresentTiming timing;
+        int currentInterval = -1;
+    };
+
+    std::vector<Entry> m_entries;
+    std::uint64_t m_frequency = 0;
+
+    void swap(Entry& entry, int interval) {
+        entry.timing.window.makeContextCurrent();
+        if (entry.currentInterval != interval) {
+            swapInterval(interval);
+            entry.currentInterval = interval;
+        }
+        std::uint64_t start = timerValue();
+        entry.timing.window.swapBuffers();
+        std::uint64_t end = timerValue();
+
+        double frequency = static_cast<double>(m_frequency);
+        double presentedAt = static_cast<double>(end) / frequency;
+        entry.timing.interval = interval;
+        entry.timing.swapTime = static_cast<double>(end - start) / frequency;
+        entry.timing.frameTime = entry.timing.presentedAt > 0.0 ? presentedAt - entry.timing.presentedAt : 0.0;
+        entry.timing.presentedAt = presentedAt;
+    }
+
+public:
+    void addWindow(Window window, bool vsync = true) {
+        for (auto& entry : m_entries) {
+            if (entry.timing.window == window) {
+                entry.timing.vsync = vsync;
+                return;
+            }
+        }
+        Entry entry;
+        entry.timing.window = window;
+        entry.timing.vsync = vsync;
+        m_entries.push_back(entry);
+    }
+
+    void removeWindow(Window window) noexcept {
+        std::erase_if(m_entries, [window](const Entry& entry) { return entry.timing.window == window; });
+    }
+
+    void setVsync(Window window, bool vsync) {
+        addWindow(window, vsync);
+    }
+
+    GLFW_HPP_NODISCARD std::size_t size() const noexcept {
+        return m_entries.size();
+    }
+
+    // Forgets cached swap intervals, e.g. after something else called `swapInterval()`
+    void invalidateIntervals() noexcept {
+        for (auto& entry : m_entries) {
+            entry.currentInterval = -1;
+        }
+    }
+
+    // Swaps the buffers of all windows
+    void present() {
+        if (m_entries.empty()) {
+            return;
+        }
+        if (m_frequency == 0) {
+            m_frequency = timerFrequency();
+        }
+        Window previous = currentContext();
+
+        Entry* anchor = nullptr;
+        for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++it) {
+            if (it->timing.vsync) {
+                anchor = &*it;
+                break;
+            }
+        }
+        for (auto& entry : m_entries) {
+            if (&entry != anchor) {
+                swap(entry, 0);
+            }
+        }
+        if (anchor != nullptr) {
+            swap(*anchor, 1);
+        }
+
+        // Window{} detaches the last swapped context if none was current on entry
+        previous.makeContextCurrent();
+    }
+
+    GLFW_HPP_NODISCARD std::optional<PresentTiming> timing(Window window) const noexcept {
+        for (const auto& entry : m_entries) {
+            if (entry.timing.window == window) {
+                return entry.timing;
+            }
+        }
+        return std::nullopt;
+    }
+
+    GLFW_HPP_NODISCARD std::vector<PresentTiming> timings() const {
+        std::vector<PresentTiming> result;
+        result.reserve(m_entries.size());
+        for (const auto& entry : m_entries) {
+            result.push_back(entry.timing);
+        }
+        return result;
+    }
+};
+}
+
+#endif // GLFW_HPP_CONTEXT_INCLUDED
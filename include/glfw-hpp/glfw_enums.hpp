@@ -0,0 +1,1955 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Enums of the GLFW API with their reflection tables. Needs only the C header and a few
+// lightweight standard headers, for code that uses `Key`, `Button` and friends without
+// the wrapper classes.
+
+#ifndef GLFW_HPP_ENUMS_INCLUDED
+#define GLFW_HPP_ENUMS_INCLUDED
+
+#include "./glfw_config.hpp"
+
+#ifndef GLFW_HPP_MODULE
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+// !begin_generated
+// !generate_enums
+GLFW_HPP_EXPORT enum class VersionComponent {
+    eMajor = GLFW_VERSION_MAJOR,
+    eMinor = GLFW_VERSION_MINOR,
+    eRevision = GLFW_VERSION_REVISION,
+};
+GLFW_HPP_EXPORT enum class Action {
+    eRelease = GLFW_RELEASE,
+    ePress = GLFW_PRESS,
+    eRepeat = GLFW_REPEAT,
+};
+GLFW_HPP_EXPORT enum class HatState {
+    eCentered = GLFW_HAT_CENTERED,
+    eUp = GLFW_HAT_UP,
+    eRight = GLFW_HAT_RIGHT,
+    eDown = GLFW_HAT_DOWN,
+    eLeft = GLFW_HAT_LEFT,
+    eRightUp = GLFW_HAT_RIGHT_UP,
+    eRightDown = GLFW_HAT_RIGHT_DOWN,
+    eLeftUp = GLFW_HAT_LEFT_UP,
+    eLeftDown = GLFW_HAT_LEFT_DOWN,
+};
+GLFW_HPP_EXPORT enum class Key {
+    eUnknown = GLFW_KEY_UNKNOWN,
+    eSpace = GLFW_KEY_SPACE,
+    eApostrophe = GLFW_KEY_APOSTROPHE,
+    eComma = GLFW_KEY_COMMA,
+    eMinus = GLFW_KEY_MINUS,
+    ePeriod = GLFW_KEY_PERIOD,
+    eSlash = GLFW_KEY_SLASH,
+    e0 = GLFW_KEY_0,
+    e1 = GLFW_KEY_1,
+    e2 = GLFW_KEY_2,
+    e3 = GLFW_KEY_3,
+    e4 = GLFW_KEY_4,
+    e5 = GLFW_KEY_5,
+    e6 = GLFW_KEY_6,
+    e7 = GLFW_KEY_7,
+    e8 = GLFW_KEY_8,
+    e9 = GLFW_KEY_9,
+    eSemicolon = GLFW_KEY_SEMICOLON,
+    eEqual = GLFW_KEY_EQUAL,
+    eA = GLFW_KEY_A,
+    eB = GLFW_KEY_B,
+    eC = GLFW_KEY_C,
+    eD = GLFW_KEY_D,
+    eE = GLFW_KEY_E,
+    eF = GLFW_KEY_F,
+    eG = GLFW_KEY_G,
+    eH = GLFW_KEY_H,
+    eI = GLFW_KEY_I,
+    eJ = GLFW_KEY_J,
+    eK = GLFW_KEY_K,
+    eL = GLFW_KEY_L,
+    eM = GLFW_KEY_M,
+    eN = GLFW_KEY_N,
+    eO = GLFW_KEY_O,
+    eP = GLFW_KEY_P,
+    eQ = GLFW_KEY_Q,
+    eR = GLFW_KEY_R,
+    eS = GLFW_KEY_S,
+    eT = GLFW_KEY_T,
+    eU = GLFW_KEY_U,
+    eV = GLFW_KEY_V,
+    eW = GLFW_KEY_W,
+    eX = GLFW_KEY_X,
+    eY = GLFW_KEY_Y,
+    eZ = GLFW_KEY_Z,
+    eLeftBracket = GLFW_KEY_LEFT_BRACKET,
+    eBackslash = GLFW_KEY_BACKSLASH,
+    eRightBracket = GLFW_KEY_RIGHT_BRACKET,
+    eGraveAccent = GLFW_KEY_GRAVE_ACCENT,
+    eWorld1 = GLFW_KEY_WORLD_1,
+    eWorld2 = GLFW_KEY_WORLD_2,
+    eEscape = GLFW_KEY_ESCAPE,
+    eEnter = GLFW_KEY_ENTER,
+    eTab = GLFW_KEY_TAB,
+    eBackspace = GLFW_KEY_BACKSPACE,
+    eInsert = GLFW_KEY_INSERT,
+    eDelete = GLFW_KEY_DELETE,
+    eRight = GLFW_KEY_RIGHT,
+    eLeft = GLFW_KEY_LEFT,
+    eDown = GLFW_KEY_DOWN,
+    eUp = GLFW_KEY_UP,
+    ePageUp = GLFW_KEY_PAGE_UP,
+    ePageDown = GLFW_KEY_PAGE_DOWN,
+    eHome = GLFW_KEY_HOME,
+    eEnd = GLFW_KEY_END,
+    eCapsLock = GLFW_KEY_CAPS_LOCK,
+    eScrollLock = GLFW_KEY_SCROLL_LOCK,
+    eNumLock = GLFW_KEY_NUM_LOCK,
+    ePrintScreen = GLFW_KEY_PRINT_SCREEN,
+    ePause = GLFW_KEY_PAUSE,
+    eF1 = GLFW_KEY_F1,
+    eF2 = GLFW_KEY_F2,
+    eF3 = GLFW_KEY_F3,
+    eF4 = GLFW_KEY_F4,
+    eF5 = GLFW_KEY_F5,
+    eF6 = GLFW_KEY_F6,
+    eF7 = GLFW_KEY_F7,
+    eF8 = GLFW_KEY_F8,
+    eF9 = GLFW_KEY_F9,
+    eF10 = GLFW_KEY_F10,
+    eF11 = GLFW_KEY_F11,
+    eF12 = GLFW_KEY_F12,
+    eF13 = GLFW_KEY_F13,
+    eF14 = GLFW_KEY_F14,
+    eF15 = GLFW_KEY_F15,
+    eF16 = GLFW_KEY_F16,
+    eF17 = GLFW_KEY_F17,
+    eF18 = GLFW_KEY_F18,
+    eF19 = GLFW_KEY_F19,
+    eF20 = GLFW_KEY_F20,
+    eF21 = GLFW_KEY_F21,
+    eF22 = GLFW_KEY_F22,
+    eF23 = GLFW_KEY_F23,
+    eF24 = GLFW_KEY_F24,
+    eF25 = GLFW_KEY_F25,
+    eKp0 = GLFW_KEY_KP_0,
+    eKp1 = GLFW_KEY_KP_1,
+    eKp2 = GLFW_KEY_KP_2,
+    eKp3 = GLFW_KEY_KP_3,
+    eKp4 = GLFW_KEY_KP_4,
+    eKp5 = GLFW_KEY_KP_5,
+    eKp6 = GLFW_KEY_KP_6,
+    eKp7 = GLFW_KEY_KP_7,
+    eKp8 = GLFW_KEY_KP_8,
+    eKp9 = GLFW_KEY_KP_9,
+    eKpDecimal = GLFW_KEY_KP_DECIMAL,
+    eKpDivide = GLFW_KEY_KP_DIVIDE,
+    eKpMultiply = GLFW_KEY_KP_MULTIPLY,
+    eKpSubtract = GLFW_KEY_KP_SUBTRACT,
+    eKpAdd = GLFW_KEY_KP_ADD,
+    eKpEnter = GLFW_KEY_KP_ENTER,
+    eKpEqual = GLFW_KEY_KP_EQUAL,
+    eLeftShift = GLFW_KEY_LEFT_SHIFT,
+    eLeftControl = GLFW_KEY_LEFT_CONTROL,
+    eLeftAlt = GLFW_KEY_LEFT_ALT,
+    eLeftSuper = GLFW_KEY_LEFT_SUPER,
+    eRightShift = GLFW_KEY_RIGHT_SHIFT,
+    eRightControl = GLFW_KEY_RIGHT_CONTROL,
+    eRightAlt = GLFW_KEY_RIGHT_ALT,
+    eRightSuper = GLFW_KEY_RIGHT_SUPER,
+    eMenu = GLFW_KEY_MENU,
+    eLast = GLFW_KEY_LAST,
+};
+GLFW_HPP_EXPORT enum class Mods {
+    eShift = GLFW_MOD_SHIFT,
+    eControl = GLFW_MOD_CONTROL,
+    eAlt = GLFW_MOD_ALT,
+    eSuper = GLFW_MOD_SUPER,
+    eCapsLock = GLFW_MOD_CAPS_LOCK,
+    eNumLock = GLFW_MOD_NUM_LOCK,
+};
+GLFW_HPP_EXPORT enum class Button {
+    e1 = GLFW_MOUSE_BUTTON_1,
+    e2 = GLFW_MOUSE_BUTTON_2,
+    e3 = GLFW_MOUSE_BUTTON_3,
+    e4 = GLFW_MOUSE_BUTTON_4,
+    e5 = GLFW_MOUSE_BUTTON_5,
+    e6 = GLFW_MOUSE_BUTTON_6,
+    e7 = GLFW_MOUSE_BUTTON_7,
+    e8 = GLFW_MOUSE_BUTTON_8,
+    eLast = GLFW_MOUSE_BUTTON_LAST,
+    eLeft = GLFW_MOUSE_BUTTON_LEFT,
+    eRight = GLFW_MOUSE_BUTTON_RIGHT,
+    eMiddle = GLFW_MOUSE_BUTTON_MIDDLE,
+};
+GLFW_HPP_EXPORT enum class GamepadButton {
+    eA = GLFW_GAMEPAD_BUTTON_A,
+    eB = GLFW_GAMEPAD_BUTTON_B,
+    eX = GLFW_GAMEPAD_BUTTON_X,
+    eY = GLFW_GAMEPAD_BUTTON_Y,
+    eLeftBumper = GLFW_GAMEPAD_BUTTON_LEFT_BUMPER,
+    eRightBumper = GLFW_GAMEPAD_BUTTON_RIGHT_BUMPER,
+    eBack = GLFW_GAMEPAD_BUTTON_BACK,
+    eStart = GLFW_GAMEPAD_BUTTON_START,
+    eGuide = GLFW_GAMEPAD_BUTTON_GUIDE,
+    eLeftThumb = GLFW_GAMEPAD_BUTTON_LEFT_THUMB,
+    eRightThumb = GLFW_GAMEPAD_BUTTON_RIGHT_THUMB,
+    eDpadUp = GLFW_GAMEPAD_BUTTON_DPAD_UP,
+    eDpadRight = GLFW_GAMEPAD_BUTTON_DPAD_RIGHT,
+    eDpadDown = GLFW_GAMEPAD_BUTTON_DPAD_DOWN,
+    eDpadLeft = GLFW_GAMEPAD_BUTTON_DPAD_LEFT,
+    eLast = GLFW_GAMEPAD_BUTTON_LAST,
+    eCross = GLFW_GAMEPAD_BUTTON_CROSS,
+    eCircle = GLFW_GAMEPAD_BUTTON_CIRCLE,
+    eSquare = GLFW_GAMEPAD_BUTTON_SQUARE,
+    eTriangle = GLFW_GAMEPAD_BUTTON_TRIANGLE,
+};
+GLFW_HPP_EXPORT enum class GamepadAxis {
+    eLeftX = GLFW_GAMEPAD_AXIS_LEFT_X,
+    eLeftY = GLFW_GAMEPAD_AXIS_LEFT_Y,
+    eRightX = GLFW_GAMEPAD_AXIS_RIGHT_X,
+    eRightY = GLFW_GAMEPAD_AXIS_RIGHT_Y,
+    eLeftTrigger = GLFW_GAMEPAD_AXIS_LEFT_TRIGGER,
+    eRightTrigger = GLFW_GAMEPAD_AXIS_RIGHT_TRIGGER,
+    eLast = GLFW_GAMEPAD_AXIS_LAST,
+};
+GLFW_HPP_EXPORT enum class Error {
+    eNoError = GLFW_NO_ERROR,
+    eNotInitialized = GLFW_NOT_INITIALIZED,
+    eNoCurrentContext = GLFW_NO_CURRENT_CONTEXT,
+    eInvalidEnum = GLFW_INVALID_ENUM,
+    eInvalidValue = GLFW_INVALID_VALUE,
+    eOutOfMemory = GLFW_OUT_OF_MEMORY,
+    eApiUnavailable = GLFW_API_UNAVAILABLE,
+    eVersionUnavailable = GLFW_VERSION_UNAVAILABLE,
+    ePlatformError = GLFW_PLATFORM_ERROR,
+    eFormatUnavailable = GLFW_FORMAT_UNAVAILABLE,
+    eNoWindowContext = GLFW_NO_WINDOW_CONTEXT,
+    eCursorUnavailable = GLFW_CURSOR_UNAVAILABLE,
+    eFeatureUnavailable = GLFW_FEATURE_UNAVAILABLE,
+    eFeatureUnimplemented = GLFW_FEATURE_UNIMPLEMENTED,
+    ePlatformUnavailable = GLFW_PLATFORM_UNAVAILABLE,
+};
+GLFW_HPP_EXPORT enum class WindowAttrib {
+    eFocused = GLFW_FOCUSED,
+    eIconified = GLFW_ICONIFIED,
+    eResizable = GLFW_RESIZABLE,
+    eVisible = GLFW_VISIBLE,
+    eDecorated = GLFW_DECORATED,
+    eAutoIconify = GLFW_AUTO_ICONIFY,
+    eFloating = GLFW_FLOATING,
+    eMaximized = GLFW_MAXIMIZED,
+    eTransparentFramebuffer = GLFW_TRANSPARENT_FRAMEBUFFER,
+    eHovered = GLFW_HOVERED,
+    eFocusOnShow = GLFW_FOCUS_ON_SHOW,
+    eMousePassthrough = GLFW_MOUSE_PASSTHROUGH,
+};
+GLFW_HPP_EXPORT enum class WindowHint {
+    eFocused = GLFW_FOCUSED,
+    eIconified = GLFW_ICONIFIED,
+    eResizable = GLFW_RESIZABLE,
+    eVisible = GLFW_VISIBLE,
+    eDecorated = GLFW_DECORATED,
+    eAutoIconify = GLFW_AUTO_ICONIFY,
+    eFloating = GLFW_FLOATING,
+    eMaximized = GLFW_MAXIMIZED,
+    eCenterCursor = GLFW_CENTER_CURSOR,
+    eTransparentFramebuffer = GLFW_TRANSPARENT_FRAMEBUFFER,
+    eFocusOnShow = GLFW_FOCUS_ON_SHOW,
+    eMousePassthrough = GLFW_MOUSE_PASSTHROUGH,
+    ePositionX = GLFW_POSITION_X,
+    ePositionY = GLFW_POSITION_Y,
+    eRedBits = GLFW_RED_BITS,
+    eGreenBits = GLFW_GREEN_BITS,
+    eBlueBits = GLFW_BLUE_BITS,
+    eAlphaBits = GLFW_ALPHA_BITS,
+    eDepthBits = GLFW_DEPTH_BITS,
+    eStencilBits = GLFW_STENCIL_BITS,
+    eAccumRedBits = GLFW_ACCUM_RED_BITS,
+    eAccumGreenBits = GLFW_ACCUM_GREEN_BITS,
+    eAccumBlueBits = GLFW_ACCUM_BLUE_BITS,
+    eAccumAlphaBits = GLFW_ACCUM_ALPHA_BITS,
+    eAuxBuffers = GLFW_AUX_BUFFERS,
+    eStereo = GLFW_STEREO,
+    eSamples = GLFW_SAMPLES,
+    eSrgbCapable = GLFW_SRGB_CAPABLE,
+    eRefreshRate = GLFW_REFRESH_RATE,
+    eDoublebuffer = GLFW_DOUBLEBUFFER,
+    eClientApi = GLFW_CLIENT_API,
+    eContextVersionMajor = GLFW_CONTEXT_VERSION_MAJOR,
+    eContextVersionMinor = GLFW_CONTEXT_VERSION_MINOR,
+    eContextRevision = GLFW_CONTEXT_REVISION,
+    eContextRobustness = GLFW_CONTEXT_ROBUSTNESS,
+    eOpenglForwardCompat = GLFW_OPENGL_FORWARD_COMPAT,
+    eContextDebug = GLFW_CONTEXT_DEBUG,
+    eOpenglProfile = GLFW_OPENGL_PROFILE,
+    eContextReleaseBehavior = GLFW_CONTEXT_RELEASE_BEHAVIOR,
+    eContextNoError = GLFW_CONTEXT_NO_ERROR,
+    eContextCreationApi = GLFW_CONTEXT_CREATION_API,
+    eScaleToMonitor = GLFW_SCALE_TO_MONITOR,
+    eScaleFramebuffer = GLFW_SCALE_FRAMEBUFFER,
+    eCocoaRetinaFramebuffer = GLFW_COCOA_RETINA_FRAMEBUFFER,
+    eCocoaFrameName = GLFW_COCOA_FRAME_NAME,
+    eCocoaGraphicsSwitching = GLFW_COCOA_GRAPHICS_SWITCHING,
+    eX11ClassName = GLFW_X11_CLASS_NAME,
+    eX11InstanceName = GLFW_X11_INSTANCE_NAME,
+    eWin32KeyboardMenu = GLFW_WIN32_KEYBOARD_MENU,
+    eWin32Showdefault = GLFW_WIN32_SHOWDEFAULT,
+    eWaylandAppId = GLFW_WAYLAND_APP_ID,
+};
+GLFW_HPP_EXPORT enum class WindowHintClientApi {
+    eNoApi = GLFW_NO_API,
+    eOpenglApi = GLFW_OPENGL_API,
+    eOpenglEsApi = GLFW_OPENGL_ES_API,
+};
+GLFW_HPP_EXPORT enum class WindowHintContextRobustness {
+    eNoRobustness = GLFW_NO_ROBUSTNESS,
+    eNoResetNotification = GLFW_NO_RESET_NOTIFICATION,
+    eLoseContextOnReset = GLFW_LOSE_CONTEXT_ON_RESET,
+};
+GLFW_HPP_EXPORT enum class WindowHintOpenglProfile {
+    eAny = GLFW_OPENGL_ANY_PROFILE,
+    eCore = GLFW_OPENGL_CORE_PROFILE,
+    eCompat = GLFW_OPENGL_COMPAT_PROFILE,
+};
+GLFW_HPP_EXPORT enum class WindowHintContextReleaseBehavior {
+    eAny = GLFW_RELEASE_BEHAVIOR_ANY,
+    eFlush = GLFW_RELEASE_BEHAVIOR_FLUSH,
+    eNone = GLFW_RELEASE_BEHAVIOR_NONE,
+};
+GLFW_HPP_EXPORT enum class WindowHintContextCreationApi {
+    eNative = GLFW_NATIVE_CONTEXT_API,
+    eEgl = GLFW_EGL_CONTEXT_API,
+    eOsmesa = GLFW_OSMESA_CONTEXT_API,
+};
+GLFW_HPP_EXPORT enum class InputMode {
+    eCursor = GLFW_CURSOR,
+    eStickyKeys = GLFW_STICKY_KEYS,
+    eStickyMouseButtons = GLFW_STICKY_MOUSE_BUTTONS,
+    eLockKeyMods = GLFW_LOCK_KEY_MODS,
+    eRawMouseMotion = GLFW_RAW_MOUSE_MOTION,
+};
+GLFW_HPP_EXPORT enum class InputModeCursor {
+    eNormal = GLFW_CURSOR_NORMAL,
+    eHidden = GLFW_CURSOR_HIDDEN,
+    eDisabled = GLFW_CURSOR_DISABLED,
+    eCaptured = GLFW_CURSOR_CAPTURED,
+};
+GLFW_HPP_EXPORT enum class InitHint {
+    ePlatform = GLFW_PLATFORM,
+    eJoystickHatButtons = GLFW_JOYSTICK_HAT_BUTTONS,
+    eAnglePlatformType = GLFW_ANGLE_PLATFORM_TYPE,
+    eCocoaChdirResources = GLFW_COCOA_CHDIR_RESOURCES,
+    eCocoaMenubar = GLFW_COCOA_MENUBAR,
+    eWaylandLibdecor = GLFW_WAYLAND_LIBDECOR,
+    eX11XcbVulkanSurface = GLFW_X11_XCB_VULKAN_SURFACE,
+};
+GLFW_HPP_EXPORT enum class Platform {
+    eWin32 = GLFW_PLATFORM_WIN32,
+    eCocoa = GLFW_PLATFORM_COCOA,
+    eWayland = GLFW_PLATFORM_WAYLAND,
+    eX11 = GLFW_PLATFORM_X11,
+    eNull = GLFW_PLATFORM_NULL,
+};
+GLFW_HPP_EXPORT enum class InitHintPlatform {
+    eAny = GLFW_PLATFORM_ANY,
+    eWin32 = GLFW_PLATFORM_WIN32,
+    eCocoa = GLFW_PLATFORM_COCOA,
+    eWayland = GLFW_PLATFORM_WAYLAND,
+    eX11 = GLFW_PLATFORM_X11,
+    eNull = GLFW_PLATFORM_NULL,
+};
+GLFW_HPP_EXPORT enum class InitHintAnglePlatformType {
+    eNone = GLFW_ANGLE_PLATFORM_TYPE_NONE,
+    eOpengl = GLFW_ANGLE_PLATFORM_TYPE_OPENGL,
+    eOpengles = GLFW_ANGLE_PLATFORM_TYPE_OPENGLES,
+    eD3D9 = GLFW_ANGLE_PLATFORM_TYPE_D3D9,
+    eD3D11 = GLFW_ANGLE_PLATFORM_TYPE_D3D11,
+    eVulkan = GLFW_ANGLE_PLATFORM_TYPE_VULKAN,
+    eMetal = GLFW_ANGLE_PLATFORM_TYPE_METAL,
+};
+GLFW_HPP_EXPORT enum class InitHintWaylandLibdecor {
+    ePrefer = GLFW_WAYLAND_PREFER_LIBDECOR,
+    eDisable = GLFW_WAYLAND_DISABLE_LIBDECOR,
+};
+GLFW_HPP_EXPORT enum class CursorShape {
+    eArrow = GLFW_ARROW_CURSOR,
+    eIbeam = GLFW_IBEAM_CURSOR,
+    eCrosshair = GLFW_CROSSHAIR_CURSOR,
+    ePointingHand = GLFW_POINTING_HAND_CURSOR,
+    eResizeEw = GLFW_RESIZE_EW_CURSOR,
+    eResizeNs = GLFW_RESIZE_NS_CURSOR,
+    eResizeNwse = GLFW_RESIZE_NWSE_CURSOR,
+    eResizeNesw = GLFW_RESIZE_NESW_CURSOR,
+    eResizeAll = GLFW_RESIZE_ALL_CURSOR,
+    eNotAllowed = GLFW_NOT_ALLOWED_CURSOR,
+    eHresize = GLFW_HRESIZE_CURSOR,
+    eVresize = GLFW_VRESIZE_CURSOR,
+    eHand = GLFW_HAND_CURSOR,
+};
+GLFW_HPP_EXPORT enum class JoystickEvent {
+    eConnected = GLFW_CONNECTED,
+    eDisconnected = GLFW_DISCONNECTED,
+};
+// !end_generated
+
+GLFW_HPP_EXPORT Mods operator|(Mods lhs, Mods rhs) {
+    return static_cast<Mods>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+GLFW_HPP_EXPORT Mods operator&(Mods lhs, Mods rhs) {
+    return static_cast<Mods>(static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs));
+}
+GLFW_HPP_EXPORT Mods operator^(Mods lhs, Mods rhs) {
+    return static_cast<Mods>(static_cast<unsigned>(lhs) ^ static_cast<unsigned>(rhs));
+}
+GLFW_HPP_EXPORT Mods operator~(Mods mod) {
+    return static_cast<Mods>(~static_cast<unsigned>(mod));
+}
+
+// Compile-time reflection of the enums above. Names drop the "e" prefix ("Space", "LeftShift"),
+// aliases of earlier values (such as `Key::eLast`) are omitted, and string lookup goes
+// through a perfect hash table whose seed generate.py searches for.
+GLFW_HPP_EXPORT template <typename Enum>
+struct EnumTraits;
+
+GLFW_HPP_API_NODISCARD constexpr std::uint32_t enumNameHash(std::uint32_t seed, std::string_view name) noexcept {
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+GLFW_HPP_EXPORT template <typename Enum>
+GLFW_HPP_NODISCARD constexpr std::size_t enumCount() noexcept {
+    return EnumTraits<Enum>::count;
+}
+
+GLFW_HPP_EXPORT template <typename Enum>
+GLFW_HPP_NODISCARD constexpr std::span<const Enum> enumValues() noexcept {
+    return EnumTraits<Enum>::values;
+}
+
+// Dense index in [0, enumCount<Enum>()), or enumCount<Enum>() for values outside the enum
+GLFW_HPP_EXPORT template <typename Enum>
+GLFW_HPP_NODISCARD constexpr std::size_t enumIndex(Enum value) noexcept {
+    return EnumTraits<Enum>::index(value);
+}
+
+// Enumerator name without the "e" prefix, or an empty view for values outside the enum
+GLFW_HPP_EXPORT template <typename Enum>
+GLFW_HPP_NODISCARD constexpr std::string_view enumName(Enum value) noexcept {
+    std::size_t index = EnumTraits<Enum>::index(value);
+    return index < EnumTraits<Enum>::count ? EnumTraits<Enum>::names[index] : std::string_view{};
+}
+
+GLFW_HPP_EXPORT template <typename Enum>
+GLFW_HPP_NODISCARD constexpr std::optional<Enum> enumFromString(std::string_view name) noexcept {
+    using Traits = EnumTraits<Enum>;
+    std::size_t slot = enumNameHash(Traits::hashSeed, name) & (Traits::hashTable.size() - 1);
+    std::size_t entry = Traits::hashTable[slot];
+    if (entry == 0 || Traits::names[entry - 1] != name) {
+        return std::nullopt;
+    }
+    return Traits::values[entry - 1];
+}
+
+// !begin_generated
+// !generate_enum_reflection
+template <> struct EnumTraits<VersionComponent> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<VersionComponent, count> values = {
+        VersionComponent::eMajor,
+        VersionComponent::eMinor,
+        VersionComponent::eRevision,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Major",
+        "Minor",
+        "Revision",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        3, 0, 1, 0, 0, 0, 2, 0,
+    };
+    static constexpr std::size_t index(VersionComponent value) noexcept {
+        switch (value) {
+            case VersionComponent::eMajor: return 0;
+            case VersionComponent::eMinor: return 1;
+            case VersionComponent::eRevision: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Action> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<Action, count> values = {
+        Action::eRelease,
+        Action::ePress,
+        Action::eRepeat,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Release",
+        "Press",
+        "Repeat",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        0, 0, 3, 0, 2, 0, 1, 0,
+    };
+    static constexpr std::size_t index(Action value) noexcept {
+        switch (value) {
+            case Action::eRelease: return 0;
+            case Action::ePress: return 1;
+            case Action::eRepeat: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<HatState> {
+    static constexpr std::size_t count = 9;
+    static constexpr std::uint32_t hashSeed = 1;
+    static constexpr std::array<HatState, count> values = {
+        HatState::eCentered,
+        HatState::eUp,
+        HatState::eRight,
+        HatState::eDown,
+        HatState::eLeft,
+        HatState::eRightUp,
+        HatState::eRightDown,
+        HatState::eLeftUp,
+        HatState::eLeftDown,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Centered",
+        "Up",
+        "Right",
+        "Down",
+        "Left",
+        "RightUp",
+        "RightDown",
+        "LeftUp",
+        "LeftDown",
+    };
+    static constexpr std::array<std::uint16_t, 32> hashTable = {
+        8, 0, 0, 0, 0, 5, 7, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 6, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+    };
+    static constexpr std::size_t index(HatState value) noexcept {
+        switch (value) {
+            case HatState::eCentered: return 0;
+            case HatState::eUp: return 1;
+            case HatState::eRight: return 2;
+            case HatState::eDown: return 3;
+            case HatState::eLeft: return 4;
+            case HatState::eRightUp: return 5;
+            case HatState::eRightDown: return 6;
+            case HatState::eLeftUp: return 7;
+            case HatState::eLeftDown: return 8;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Key> {
+    static constexpr std::size_t count = 121;
+    static constexpr std::uint32_t hashSeed = 13;
+    static constexpr std::array<Key, count> values = {
+        Key::eUnknown,
+        Key::eSpace,
+        Key::eApostrophe,
+        Key::eComma,
+        Key::eMinus,
+        Key::ePeriod,
+        Key::eSlash,
+        Key::e0,
+        Key::e1,
+        Key::e2,
+        Key::e3,
+        Key::e4,
+        Key::e5,
+        Key::e6,
+        Key::e7,
+        Key::e8,
+        Key::e9,
+        Key::eSemicolon,
+        Key::eEqual,
+        Key::eA,
+        Key::eB,
+        Key::eC,
+        Key::eD,
+        Key::eE,
+        Key::eF,
+        Key::eG,
+        Key::eH,
+        Key::eI,
+        Key::eJ,
+        Key::eK,
+        Key::eL,
+        Key::eM,
+        Key::eN,
+        Key::eO,
+        Key::eP,
+        Key::eQ,
+        Key::eR,
+        Key::eS,
+        Key::eT,
+        Key::eU,
+        Key::eV,
+        Key::eW,
+        Key::eX,
+        Key::eY,
+        Key::eZ,
+        Key::eLeftBracket,
+        Key::eBackslash,
+        Key::eRightBracket,
+        Key::eGraveAccent,
+        Key::eWorld1,
+        Key::eWorld2,
+        Key::eEscape,
+        Key::eEnter,
+        Key::eTab,
+        Key::eBackspace,
+        Key::eInsert,
+        Key::eDelete,
+        Key::eRight,
+        Key::eLeft,
+        Key::eDown,
+        Key::eUp,
+        Key::ePageUp,
+        Key::ePageDown,
+        Key::eHome,
+        Key::eEnd,
+        Key::eCapsLock,
+        Key::eScrollLock,
+        Key::eNumLock,
+        Key::ePrintScreen,
+        Key::ePause,
+        Key::eF1,
+        Key::eF2,
+        Key::eF3,
+        Key::eF4,
+        Key::eF5,
+        Key::eF6,
+        Key::eF7,
+        Key::eF8,
+        Key::eF9,
+        Key::eF10,
+        Key::eF11,
+        Key::eF12,
+        Key::eF13,
+        Key::eF14,
+        Key::eF15,
+        Key::eF16,
+        Key::eF17,
+        Key::eF18,
+        Key::eF19,
+        Key::eF20,
+        Key::eF21,
+        Key::eF22,
+        Key::eF23,
+        Key::eF24,
+        Key::eF25,
+        Key::eKp0,
+        Key::eKp1,
+        Key::eKp2,
+        Key::eKp3,
+        Key::eKp4,
+        Key::eKp5,
+        Key::eKp6,
+        Key::eKp7,
+        Key::eKp8,
+        Key::eKp9,
+        Key::eKpDecimal,
+        Key::eKpDivide,
+        Key::eKpMultiply,
+        Key::eKpSubtract,
+        Key::eKpAdd,
+        Key::eKpEnter,
+        Key::eKpEqual,
+        Key::eLeftShift,
+        Key::eLeftControl,
+        Key::eLeftAlt,
+        Key::eLeftSuper,
+        Key::eRightShift,
+        Key::eRightControl,
+        Key::eRightAlt,
+        Key::eRightSuper,
+        Key::eMenu,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Unknown",
+        "Space",
+        "Apostrophe",
+        "Comma",
+        "Minus",
+        "Period",
+        "Slash",
+        "0",
+        "1",
+        "2",
+        "3",
+        "4",
+        "5",
+        "6",
+        "7",
+        "8",
+        "9",
+        "Semicolon",
+        "Equal",
+        "A",
+        "B",
+        "C",
+        "D",
+        "E",
+        "F",
+        "G",
+        "H",
+        "I",
+        "J",
+        "K",
+        "L",
+        "M",
+        "N",
+        "O",
+        "P",
+        "Q",
+        "R",
+        "S",
+        "T",
+        "U",
+        "V",
+        "W",
+        "X",
+        "Y",
+        "Z",
+        "LeftBracket",
+        "Backslash",
+        "RightBracket",
+        "GraveAccent",
+        "World1",
+        "World2",
+        "Escape",
+        "Enter",
+        "Tab",
+        "Backspace",
+        "Insert",
+        "Delete",
+        "Right",
+        "Left",
+        "Down",
+        "Up",
+        "PageUp",
+        "PageDown",
+        "Home",
+        "End",
+        "CapsLock",
+        "ScrollLock",
+        "NumLock",
+        "PrintScreen",
+        "Pause",
+        "F1",
+        "F2",
+        "F3",
+        "F4",
+        "F5",
+        "F6",
+        "F7",
+        "F8",
+        "F9",
+        "F10",
+        "F11",
+        "F12",
+        "F13",
+        "F14",
+        "F15",
+        "F16",
+        "F17",
+        "F18",
+        "F19",
+        "F20",
+        "F21",
+        "F22",
+        "F23",
+        "F24",
+        "F25",
+        "Kp0",
+        "Kp1",
+        "Kp2",
+        "Kp3",
+        "Kp4",
+        "Kp5",
+        "Kp6",
+        "Kp7",
+        "Kp8",
+        "Kp9",
+        "KpDecimal",
+        "KpDivide",
+        "KpMultiply",
+        "KpSubtract",
+        "KpAdd",
+        "KpEnter",
+        "KpEqual",
+        "LeftShift",
+        "LeftControl",
+        "LeftAlt",
+        "LeftSuper",
+        "RightShift",
+        "RightControl",
+        "RightAlt",
+        "RightSuper",
+        "Menu",
+    };
+    static constexpr std::array<std::uint16_t, 1024> hashTable = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+        0, 7, 0, 0, 0, 0, 0, 50, 0, 0, 0, 88, 0, 26, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 70, 0, 0, 0, 0, 0,
+        0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 21, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0, 46,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+        0, 71, 106, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 15, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 0,
+        27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0,
+        0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 98, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 47, 0, 62, 0, 0, 0, 0, 0, 0, 56, 0, 0,
+        16, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 86, 0, 24, 0, 0, 0, 0, 0, 0, 0, 118,
+        0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 74, 0, 0, 0, 0, 109,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 73, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 42, 0, 0,
+        0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 37, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+        0, 0, 0, 0, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 0, 55,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0,
+        43, 0, 48, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+        0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        81, 0, 33, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 121,
+        0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111,
+        0, 11, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 97, 0,
+        116, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 25, 0, 0, 0, 0, 0,
+        0, 0, 114, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 20, 0, 75, 0, 0,
+        5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 53, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0,
+        0, 0, 1, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 60, 61, 0, 0, 0, 119, 0, 9, 0, 0, 0, 0,
+        0, 38, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0,
+        0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63,
+        0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 87, 0, 23, 0, 66, 0, 0, 6, 0, 0, 0, 0, 92, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 80, 0, 34, 0, 77, 115, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 29, 0, 72, 0, 0, 0, 0, 0, 0, 0,
+        0, 112, 0, 113, 12, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0,
+        0, 96, 117, 108, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+        0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+    static constexpr std::size_t index(Key value) noexcept {
+        switch (value) {
+            case Key::eUnknown: return 0;
+            case Key::eSpace: return 1;
+            case Key::eApostrophe: return 2;
+            case Key::eComma: return 3;
+            case Key::eMinus: return 4;
+            case Key::ePeriod: return 5;
+            case Key::eSlash: return 6;
+            case Key::e0: return 7;
+            case Key::e1: return 8;
+            case Key::e2: return 9;
+            case Key::e3: return 10;
+            case Key::e4: return 11;
+            case Key::e5: return 12;
+            case Key::e6: return 13;
+            case Key::e7: return 14;
+            case Key::e8: return 15;
+            case Key::e9: return 16;
+            case Key::eSemicolon: return 17;
+            case Key::eEqual: return 18;
+            case Key::eA: return 19;
+            case Key::eB: return 20;
+            case Key::eC: return 21;
+            case Key::eD: return 22;
+            case Key::eE: return 23;
+            case Key::eF: return 24;
+            case Key::eG: return 25;
+            case Key::eH: return 26;
+            case Key::eI: return 27;
+            case Key::eJ: return 28;
+            case Key::eK: return 29;
+            case Key::eL: return 30;
+            case Key::eM: return 31;
+            case Key::eN: return 32;
+            case Key::eO: return 33;
+            case Key::eP: return 34;
+            case Key::eQ: return 35;
+            case Key::eR: return 36;
+            case Key::eS: return 37;
+            case Key::eT: return 38;
+            case Key::eU: return 39;
+            case Key::eV: return 40;
+            case Key::eW: return 41;
+            case Key::eX: return 42;
+            case Key::eY: return 43;
+            case Key::eZ: return 44;
+            case Key::eLeftBracket: return 45;
+            case Key::eBackslash: return 46;
+            case Key::eRightBracket: return 47;
+            case Key::eGraveAccent: return 48;
+            case Key::eWorld1: return 49;
+            case Key::eWorld2: return 50;
+            case Key::eEscape: return 51;
+            case Key::eEnter: return 52;
+            case Key::eTab: return 53;
+            case Key::eBackspace: return 54;
+            case Key::eInsert: return 55;
+            case Key::eDelete: return 56;
+            case Key::eRight: return 57;
+            case Key::eLeft: return 58;
+            case Key::eDown: return 59;
+            case Key::eUp: return 60;
+            case Key::ePageUp: return 61;
+            case Key::ePageDown: return 62;
+            case Key::eHome: return 63;
+            case Key::eEnd: return 64;
+            case Key::eCapsLock: return 65;
+            case Key::eScrollLock: return 66;
+            case Key::eNumLock: return 67;
+            case Key::ePrintScreen: return 68;
+            case Key::ePause: return 69;
+            case Key::eF1: return 70;
+            case Key::eF2: return 71;
+            case Key::eF3: return 72;
+            case Key::eF4: return 73;
+            case Key::eF5: return 74;
+            case Key::eF6: return 75;
+            case Key::eF7: return 76;
+            case Key::eF8: return 77;
+            case Key::eF9: return 78;
+            case Key::eF10: return 79;
+            case Key::eF11: return 80;
+            case Key::eF12: return 81;
+            case Key::eF13: return 82;
+            case Key::eF14: return 83;
+            case Key::eF15: return 84;
+            case Key::eF16: return 85;
+            case Key::eF17: return 86;
+            case Key::eF18: return 87;
+            case Key::eF19: return 88;
+            case Key::eF20: return 89;
+            case Key::eF21: return 90;
+            case Key::eF22: return 91;
+            case Key::eF23: return 92;
+            case Key::eF24: return 93;
+            case Key::eF25: return 94;
+            case Key::eKp0: return 95;
+            case Key::eKp1: return 96;
+            case Key::eKp2: return 97;
+            case Key::eKp3: return 98;
+            case Key::eKp4: return 99;
+            case Key::eKp5: return 100;
+            case Key::eKp6: return 101;
+            case Key::eKp7: return 102;
+            case Key::eKp8: return 103;
+            case Key::eKp9: return 104;
+            case Key::eKpDecimal: return 105;
+            case Key::eKpDivide: return 106;
+            case Key::eKpMultiply: return 107;
+            case Key::eKpSubtract: return 108;
+            case Key::eKpAdd: return 109;
+            case Key::eKpEnter: return 110;
+            case Key::eKpEqual: return 111;
+            case Key::eLeftShift: return 112;
+            case Key::eLeftControl: return 113;
+            case Key::eLeftAlt: return 114;
+            case Key::eLeftSuper: return 115;
+            case Key::eRightShift: return 116;
+            case Key::eRightControl: return 117;
+            case Key::eRightAlt: return 118;
+            case Key::eRightSuper: return 119;
+            case Key::eMenu: return 120;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Mods> {
+    static constexpr std::size_t count = 6;
+    static constexpr std::uint32_t hashSeed = 9;
+    static constexpr std::array<Mods, count> values = {
+        Mods::eShift,
+        Mods::eControl,
+        Mods::eAlt,
+        Mods::eSuper,
+        Mods::eCapsLock,
+        Mods::eNumLock,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Shift",
+        "Control",
+        "Alt",
+        "Super",
+        "CapsLock",
+        "NumLock",
+    };
+    static constexpr std::array<std::uint16_t, 32> hashTable = {
+        0, 0, 0, 6, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3,
+        0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 4,
+    };
+    static constexpr std::size_t index(Mods value) noexcept {
+        switch (value) {
+            case Mods::eShift: return 0;
+            case Mods::eControl: return 1;
+            case Mods::eAlt: return 2;
+            case Mods::eSuper: return 3;
+            case Mods::eCapsLock: return 4;
+            case Mods::eNumLock: return 5;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Button> {
+    static constexpr std::size_t count = 8;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<Button, count> values = {
+        Button::e1,
+        Button::e2,
+        Button::e3,
+        Button::e4,
+        Button::e5,
+        Button::e6,
+        Button::e7,
+        Button::e8,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "1",
+        "2",
+        "3",
+        "4",
+        "5",
+        "6",
+        "7",
+        "8",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        5, 0, 3, 4, 0, 2, 7, 8, 0, 6, 0, 0, 1, 0, 0, 0,
+    };
+    static constexpr std::size_t index(Button value) noexcept {
+        switch (value) {
+            case Button::e1: return 0;
+            case Button::e2: return 1;
+            case Button::e3: return 2;
+            case Button::e4: return 3;
+            case Button::e5: return 4;
+            case Button::e6: return 5;
+            case Button::e7: return 6;
+            case Button::e8: return 7;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<GamepadButton> {
+    static constexpr std::size_t count = 15;
+    static constexpr std::uint32_t hashSeed = 1;
+    static constexpr std::array<GamepadButton, count> values = {
+        GamepadButton::eA,
+        GamepadButton::eB,
+        GamepadButton::eX,
+        GamepadButton::eY,
+        GamepadButton::eLeftBumper,
+        GamepadButton::eRightBumper,
+        GamepadButton::eBack,
+        GamepadButton::eStart,
+        GamepadButton::eGuide,
+        GamepadButton::eLeftThumb,
+        GamepadButton::eRightThumb,
+        GamepadButton::eDpadUp,
+        GamepadButton::eDpadRight,
+        GamepadButton::eDpadDown,
+        GamepadButton::eDpadLeft,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "A",
+        "B",
+        "X",
+        "Y",
+        "LeftBumper",
+        "RightBumper",
+        "Back",
+        "Start",
+        "Guide",
+        "LeftThumb",
+        "RightThumb",
+        "DpadUp",
+        "DpadRight",
+        "DpadDown",
+        "DpadLeft",
+    };
+    static constexpr std::array<std::uint16_t, 32> hashTable = {
+        12, 0, 0, 10, 9, 13, 5, 4, 8, 6, 0, 0, 0, 0, 0, 7,
+        15, 0, 2, 0, 3, 14, 0, 0, 0, 0, 0, 0, 0, 0, 11, 1,
+    };
+    static constexpr std::size_t index(GamepadButton value) noexcept {
+        switch (value) {
+            case GamepadButton::eA: return 0;
+            case GamepadButton::eB: return 1;
+            case GamepadButton::eX: return 2;
+            case GamepadButton::eY: return 3;
+            case GamepadButton::eLeftBumper: return 4;
+            case GamepadButton::eRightBumper: return 5;
+            case GamepadButton::eBack: return 6;
+            case GamepadButton::eStart: return 7;
+            case GamepadButton::eGuide: return 8;
+            case GamepadButton::eLeftThumb: return 9;
+            case GamepadButton::eRightThumb: return 10;
+            case GamepadButton::eDpadUp: return 11;
+            case GamepadButton::eDpadRight: return 12;
+            case GamepadButton::eDpadDown: return 13;
+            case GamepadButton::eDpadLeft: return 14;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<GamepadAxis> {
+    static constexpr std::size_t count = 6;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<GamepadAxis, count> values = {
+        GamepadAxis::eLeftX,
+        GamepadAxis::eLeftY,
+        GamepadAxis::eRightX,
+        GamepadAxis::eRightY,
+        GamepadAxis::eLeftTrigger,
+        GamepadAxis::eRightTrigger,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "LeftX",
+        "LeftY",
+        "RightX",
+        "RightY",
+        "LeftTrigger",
+        "RightTrigger",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        0, 0, 0, 6, 4, 0, 0, 3, 1, 0, 0, 2, 5, 0, 0, 0,
+    };
+    static constexpr std::size_t index(GamepadAxis value) noexcept {
+        switch (value) {
+            case GamepadAxis::eLeftX: return 0;
+            case GamepadAxis::eLeftY: return 1;
+            case GamepadAxis::eRightX: return 2;
+            case GamepadAxis::eRightY: return 3;
+            case GamepadAxis::eLeftTrigger: return 4;
+            case GamepadAxis::eRightTrigger: return 5;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Error> {
+    static constexpr std::size_t count = 15;
+    static constexpr std::uint32_t hashSeed = 15;
+    static constexpr std::array<Error, count> values = {
+        Error::eNoError,
+        Error::eNotInitialized,
+        Error::eNoCurrentContext,
+        Error::eInvalidEnum,
+        Error::eInvalidValue,
+        Error::eOutOfMemory,
+        Error::eApiUnavailable,
+        Error::eVersionUnavailable,
+        Error::ePlatformError,
+        Error::eFormatUnavailable,
+        Error::eNoWindowContext,
+        Error::eCursorUnavailable,
+        Error::eFeatureUnavailable,
+        Error::eFeatureUnimplemented,
+        Error::ePlatformUnavailable,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "NoError",
+        "NotInitialized",
+        "NoCurrentContext",
+        "InvalidEnum",
+        "InvalidValue",
+        "OutOfMemory",
+        "ApiUnavailable",
+        "VersionUnavailable",
+        "PlatformError",
+        "FormatUnavailable",
+        "NoWindowContext",
+        "CursorUnavailable",
+        "FeatureUnavailable",
+        "FeatureUnimplemented",
+        "PlatformUnavailable",
+    };
+    static constexpr std::array<std::uint16_t, 64> hashTable = {
+        0, 3, 0, 0, 0, 10, 0, 0, 8, 0, 0, 0, 4, 0, 0, 0,
+        11, 0, 12, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0,
+        0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+        7, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 2, 0, 1, 13, 0,
+    };
+    static constexpr std::size_t index(Error value) noexcept {
+        switch (value) {
+            case Error::eNoError: return 0;
+            case Error::eNotInitialized: return 1;
+            case Error::eNoCurrentContext: return 2;
+            case Error::eInvalidEnum: return 3;
+            case Error::eInvalidValue: return 4;
+            case Error::eOutOfMemory: return 5;
+            case Error::eApiUnavailable: return 6;
+            case Error::eVersionUnavailable: return 7;
+            case Error::ePlatformError: return 8;
+            case Error::eFormatUnavailable: return 9;
+            case Error::eNoWindowContext: return 10;
+            case Error::eCursorUnavailable: return 11;
+            case Error::eFeatureUnavailable: return 12;
+            case Error::eFeatureUnimplemented: return 13;
+            case Error::ePlatformUnavailable: return 14;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowAttrib> {
+    static constexpr std::size_t count = 12;
+    static constexpr std::uint32_t hashSeed = 4;
+    static constexpr std::array<WindowAttrib, count> values = {
+        WindowAttrib::eFocused,
+        WindowAttrib::eIconified,
+        WindowAttrib::eResizable,
+        WindowAttrib::eVisible,
+        WindowAttrib::eDecorated,
+        WindowAttrib::eAutoIconify,
+        WindowAttrib::eFloating,
+        WindowAttrib::eMaximized,
+        WindowAttrib::eTransparentFramebuffer,
+        WindowAttrib::eHovered,
+        WindowAttrib::eFocusOnShow,
+        WindowAttrib::eMousePassthrough,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Focused",
+        "Iconified",
+        "Resizable",
+        "Visible",
+        "Decorated",
+        "AutoIconify",
+        "Floating",
+        "Maximized",
+        "TransparentFramebuffer",
+        "Hovered",
+        "FocusOnShow",
+        "MousePassthrough",
+    };
+    static constexpr std::array<std::uint16_t, 64> hashTable = {
+        0, 0, 0, 0, 0, 8, 0, 6, 9, 0, 5, 0, 0, 4, 0, 0,
+        10, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 3, 11,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0,
+    };
+    static constexpr std::size_t index(WindowAttrib value) noexcept {
+        switch (value) {
+            case WindowAttrib::eFocused: return 0;
+            case WindowAttrib::eIconified: return 1;
+            case WindowAttrib::eResizable: return 2;
+            case WindowAttrib::eVisible: return 3;
+            case WindowAttrib::eDecorated: return 4;
+            case WindowAttrib::eAutoIconify: return 5;
+            case WindowAttrib::eFloating: return 6;
+            case WindowAttrib::eMaximized: return 7;
+            case WindowAttrib::eTransparentFramebuffer: return 8;
+            case WindowAttrib::eHovered: return 9;
+            case WindowAttrib::eFocusOnShow: return 10;
+            case WindowAttrib::eMousePassthrough: return 11;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHint> {
+    static constexpr std::size_t count = 51;
+    static constexpr std::uint32_t hashSeed = 21;
+    static constexpr std::array<WindowHint, count> values = {
+        WindowHint::eFocused,
+        WindowHint::eIconified,
+        WindowHint::eResizable,
+        WindowHint::eVisible,
+        WindowHint::eDecorated,
+        WindowHint::eAutoIconify,
+        WindowHint::eFloating,
+        WindowHint::eMaximized,
+        WindowHint::eCenterCursor,
+        WindowHint::eTransparentFramebuffer,
+        WindowHint::eFocusOnShow,
+        WindowHint::eMousePassthrough,
+        WindowHint::ePositionX,
+        WindowHint::ePositionY,
+        WindowHint::eRedBits,
+        WindowHint::eGreenBits,
+        WindowHint::eBlueBits,
+        WindowHint::eAlphaBits,
+        WindowHint::eDepthBits,
+        WindowHint::eStencilBits,
+        WindowHint::eAccumRedBits,
+        WindowHint::eAccumGreenBits,
+        WindowHint::eAccumBlueBits,
+        WindowHint::eAccumAlphaBits,
+        WindowHint::eAuxBuffers,
+        WindowHint::eStereo,
+        WindowHint::eSamples,
+        WindowHint::eSrgbCapable,
+        WindowHint::eRefreshRate,
+        WindowHint::eDoublebuffer,
+        WindowHint::eClientApi,
+        WindowHint::eContextVersionMajor,
+        WindowHint::eContextVersionMinor,
+        WindowHint::eContextRevision,
+        WindowHint::eContextRobustness,
+        WindowHint::eOpenglForwardCompat,
+        WindowHint::eContextDebug,
+        WindowHint::eOpenglProfile,
+        WindowHint::eContextReleaseBehavior,
+        WindowHint::eContextNoError,
+        WindowHint::eContextCreationApi,
+        WindowHint::eScaleToMonitor,
+        WindowHint::eScaleFramebuffer,
+        WindowHint::eCocoaRetinaFramebuffer,
+        WindowHint::eCocoaFrameName,
+        WindowHint::eCocoaGraphicsSwitching,
+        WindowHint::eX11ClassName,
+        WindowHint::eX11InstanceName,
+        WindowHint::eWin32KeyboardMenu,
+        WindowHint::eWin32Showdefault,
+        WindowHint::eWaylandAppId,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Focused",
+        "Iconified",
+        "Resizable",
+        "Visible",
+        "Decorated",
+        "AutoIconify",
+        "Floating",
+        "Maximized",
+        "CenterCursor",
+        "TransparentFramebuffer",
+        "FocusOnShow",
+        "MousePassthrough",
+        "PositionX",
+        "PositionY",
+        "RedBits",
+        "GreenBits",
+        "BlueBits",
+        "AlphaBits",
+        "DepthBits",
+        "StencilBits",
+        "AccumRedBits",
+        "AccumGreenBits",
+        "AccumBlueBits",
+        "AccumAlphaBits",
+        "AuxBuffers",
+        "Stereo",
+        "Samples",
+        "SrgbCapable",
+        "RefreshRate",
+        "Doublebuffer",
+        "ClientApi",
+        "ContextVersionMajor",
+        "ContextVersionMinor",
+        "ContextRevision",
+        "ContextRobustness",
+        "OpenglForwardCompat",
+        "ContextDebug",
+        "OpenglProfile",
+        "ContextReleaseBehavior",
+        "ContextNoError",
+        "ContextCreationApi",
+        "ScaleToMonitor",
+        "ScaleFramebuffer",
+        "CocoaRetinaFramebuffer",
+        "CocoaFrameName",
+        "CocoaGraphicsSwitching",
+        "X11ClassName",
+        "X11InstanceName",
+        "Win32KeyboardMenu",
+        "Win32Showdefault",
+        "WaylandAppId",
+    };
+    static constexpr std::array<std::uint16_t, 512> hashTable = {
+        28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 0, 4, 0, 18, 0, 0, 42, 0, 43, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 39, 23, 38, 0, 0, 50,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 13, 0, 0, 0, 31, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 30, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 12,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 37, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 21, 0, 0, 0, 0, 0, 0, 19, 0, 0, 20, 0, 40, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 14, 45,
+        0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 46, 0,
+        0, 0, 22, 0, 51, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 34, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 25, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 3, 0, 0,
+        0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 33, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0,
+        0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+    static constexpr std::size_t index(WindowHint value) noexcept {
+        switch (value) {
+            case WindowHint::eFocused: return 0;
+            case WindowHint::eIconified: return 1;
+            case WindowHint::eResizable: return 2;
+            case WindowHint::eVisible: return 3;
+            case WindowHint::eDecorated: return 4;
+            case WindowHint::eAutoIconify: return 5;
+            case WindowHint::eFloating: return 6;
+            case WindowHint::eMaximized: return 7;
+            case WindowHint::eCenterCursor: return 8;
+            case WindowHint::eTransparentFramebuffer: return 9;
+            case WindowHint::eFocusOnShow: return 10;
+            case WindowHint::eMousePassthrough: return 11;
+            case WindowHint::ePositionX: return 12;
+            case WindowHint::ePositionY: return 13;
+            case WindowHint::eRedBits: return 14;
+            case WindowHint::eGreenBits: return 15;
+            case WindowHint::eBlueBits: return 16;
+            case WindowHint::eAlphaBits: return 17;
+            case WindowHint::eDepthBits: return 18;
+            case WindowHint::eStencilBits: return 19;
+            case WindowHint::eAccumRedBits: return 20;
+            case WindowHint::eAccumGreenBits: return 21;
+            case WindowHint::eAccumBlueBits: return 22;
+            case WindowHint::eAccumAlphaBits: return 23;
+            case WindowHint::eAuxBuffers: return 24;
+            case WindowHint::eStereo: return 25;
+            case WindowHint::eSamples: return 26;
+            case WindowHint::eSrgbCapable: return 27;
+            case WindowHint::eRefreshRate: return 28;
+            case WindowHint::eDoublebuffer: return 29;
+            case WindowHint::eClientApi: return 30;
+            case WindowHint::eContextVersionMajor: return 31;
+            case WindowHint::eContextVersionMinor: return 32;
+            case WindowHint::eContextRevision: return 33;
+            case WindowHint::eContextRobustness: return 34;
+            case WindowHint::eOpenglForwardCompat: return 35;
+            case WindowHint::eContextDebug: return 36;
+            case WindowHint::eOpenglProfile: return 37;
+            case WindowHint::eContextReleaseBehavior: return 38;
+            case WindowHint::eContextNoError: return 39;
+            case WindowHint::eContextCreationApi: return 40;
+            case WindowHint::eScaleToMonitor: return 41;
+            case WindowHint::eScaleFramebuffer: return 42;
+            case WindowHint::eCocoaRetinaFramebuffer: return 43;
+            case WindowHint::eCocoaFrameName: return 44;
+            case WindowHint::eCocoaGraphicsSwitching: return 45;
+            case WindowHint::eX11ClassName: return 46;
+            case WindowHint::eX11InstanceName: return 47;
+            case WindowHint::eWin32KeyboardMenu: return 48;
+            case WindowHint::eWin32Showdefault: return 49;
+            case WindowHint::eWaylandAppId: return 50;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHintClientApi> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 1;
+    static constexpr std::array<WindowHintClientApi, count> values = {
+        WindowHintClientApi::eNoApi,
+        WindowHintClientApi::eOpenglApi,
+        WindowHintClientApi::eOpenglEsApi,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "NoApi",
+        "OpenglApi",
+        "OpenglEsApi",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+    };
+    static constexpr std::size_t index(WindowHintClientApi value) noexcept {
+        switch (value) {
+            case WindowHintClientApi::eNoApi: return 0;
+            case WindowHintClientApi::eOpenglApi: return 1;
+            case WindowHintClientApi::eOpenglEsApi: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHintContextRobustness> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<WindowHintContextRobustness, count> values = {
+        WindowHintContextRobustness::eNoRobustness,
+        WindowHintContextRobustness::eNoResetNotification,
+        WindowHintContextRobustness::eLoseContextOnReset,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "NoRobustness",
+        "NoResetNotification",
+        "LoseContextOnReset",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        1, 3, 0, 0, 0, 0, 2, 0,
+    };
+    static constexpr std::size_t index(WindowHintContextRobustness value) noexcept {
+        switch (value) {
+            case WindowHintContextRobustness::eNoRobustness: return 0;
+            case WindowHintContextRobustness::eNoResetNotification: return 1;
+            case WindowHintContextRobustness::eLoseContextOnReset: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHintOpenglProfile> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<WindowHintOpenglProfile, count> values = {
+        WindowHintOpenglProfile::eAny,
+        WindowHintOpenglProfile::eCore,
+        WindowHintOpenglProfile::eCompat,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Any",
+        "Core",
+        "Compat",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        0, 0, 0, 0, 0, 1, 2, 3,
+    };
+    static constexpr std::size_t index(WindowHintOpenglProfile value) noexcept {
+        switch (value) {
+            case WindowHintOpenglProfile::eAny: return 0;
+            case WindowHintOpenglProfile::eCore: return 1;
+            case WindowHintOpenglProfile::eCompat: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHintContextReleaseBehavior> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 2;
+    static constexpr std::array<WindowHintContextReleaseBehavior, count> values = {
+        WindowHintContextReleaseBehavior::eAny,
+        WindowHintContextReleaseBehavior::eFlush,
+        WindowHintContextReleaseBehavior::eNone,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Any",
+        "Flush",
+        "None",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        0, 3, 0, 2, 0, 0, 0, 1,
+    };
+    static constexpr std::size_t index(WindowHintContextReleaseBehavior value) noexcept {
+        switch (value) {
+            case WindowHintContextReleaseBehavior::eAny: return 0;
+            case WindowHintContextReleaseBehavior::eFlush: return 1;
+            case WindowHintContextReleaseBehavior::eNone: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<WindowHintContextCreationApi> {
+    static constexpr std::size_t count = 3;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<WindowHintContextCreationApi, count> values = {
+        WindowHintContextCreationApi::eNative,
+        WindowHintContextCreationApi::eEgl,
+        WindowHintContextCreationApi::eOsmesa,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Native",
+        "Egl",
+        "Osmesa",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        0, 0, 1, 2, 0, 3, 0, 0,
+    };
+    static constexpr std::size_t index(WindowHintContextCreationApi value) noexcept {
+        switch (value) {
+            case WindowHintContextCreationApi::eNative: return 0;
+            case WindowHintContextCreationApi::eEgl: return 1;
+            case WindowHintContextCreationApi::eOsmesa: return 2;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InputMode> {
+    static constexpr std::size_t count = 5;
+    static constexpr std::uint32_t hashSeed = 1;
+    static constexpr std::array<InputMode, count> values = {
+        InputMode::eCursor,
+        InputMode::eStickyKeys,
+        InputMode::eStickyMouseButtons,
+        InputMode::eLockKeyMods,
+        InputMode::eRawMouseMotion,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Cursor",
+        "StickyKeys",
+        "StickyMouseButtons",
+        "LockKeyMods",
+        "RawMouseMotion",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        0, 0, 0, 5, 0, 0, 1, 2, 0, 0, 0, 3, 0, 0, 0, 4,
+    };
+    static constexpr std::size_t index(InputMode value) noexcept {
+        switch (value) {
+            case InputMode::eCursor: return 0;
+            case InputMode::eStickyKeys: return 1;
+            case InputMode::eStickyMouseButtons: return 2;
+            case InputMode::eLockKeyMods: return 3;
+            case InputMode::eRawMouseMotion: return 4;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InputModeCursor> {
+    static constexpr std::size_t count = 4;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<InputModeCursor, count> values = {
+        InputModeCursor::eNormal,
+        InputModeCursor::eHidden,
+        InputModeCursor::eDisabled,
+        InputModeCursor::eCaptured,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Normal",
+        "Hidden",
+        "Disabled",
+        "Captured",
+    };
+    static constexpr std::array<std::uint16_t, 8> hashTable = {
+        0, 2, 1, 0, 0, 3, 0, 4,
+    };
+    static constexpr std::size_t index(InputModeCursor value) noexcept {
+        switch (value) {
+            case InputModeCursor::eNormal: return 0;
+            case InputModeCursor::eHidden: return 1;
+            case InputModeCursor::eDisabled: return 2;
+            case InputModeCursor::eCaptured: return 3;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InitHint> {
+    static constexpr std::size_t count = 7;
+    static constexpr std::uint32_t hashSeed = 4;
+    static constexpr std::array<InitHint, count> values = {
+        InitHint::ePlatform,
+        InitHint::eJoystickHatButtons,
+        InitHint::eAnglePlatformType,
+        InitHint::eCocoaChdirResources,
+        InitHint::eCocoaMenubar,
+        InitHint::eWaylandLibdecor,
+        InitHint::eX11XcbVulkanSurface,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Platform",
+        "JoystickHatButtons",
+        "AnglePlatformType",
+        "CocoaChdirResources",
+        "CocoaMenubar",
+        "WaylandLibdecor",
+        "X11XcbVulkanSurface",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        0, 6, 0, 0, 7, 0, 1, 3, 0, 2, 0, 0, 5, 0, 0, 4,
+    };
+    static constexpr std::size_t index(InitHint value) noexcept {
+        switch (value) {
+            case InitHint::ePlatform: return 0;
+            case InitHint::eJoystickHatButtons: return 1;
+            case InitHint::eAnglePlatformType: return 2;
+            case InitHint::eCocoaChdirResources: return 3;
+            case InitHint::eCocoaMenubar: return 4;
+            case InitHint::eWaylandLibdecor: return 5;
+            case InitHint::eX11XcbVulkanSurface: return 6;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<Platform> {
+    static constexpr std::size_t count = 5;
+    static constexpr std::uint32_t hashSeed = 3;
+    static constexpr std::array<Platform, count> values = {
+        Platform::eWin32,
+        Platform::eCocoa,
+        Platform::eWayland,
+        Platform::eX11,
+        Platform::eNull,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Win32",
+        "Cocoa",
+        "Wayland",
+        "X11",
+        "Null",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        4, 1, 0, 0, 3, 0, 0, 5, 0, 2, 0, 0, 0, 0, 0, 0,
+    };
+    static constexpr std::size_t index(Platform value) noexcept {
+        switch (value) {
+            case Platform::eWin32: return 0;
+            case Platform::eCocoa: return 1;
+            case Platform::eWayland: return 2;
+            case Platform::eX11: return 3;
+            case Platform::eNull: return 4;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InitHintPlatform> {
+    static constexpr std::size_t count = 6;
+    static constexpr std::uint32_t hashSeed = 3;
+    static constexpr std::array<InitHintPlatform, count> values = {
+        InitHintPlatform::eAny,
+        InitHintPlatform::eWin32,
+        InitHintPlatform::eCocoa,
+        InitHintPlatform::eWayland,
+        InitHintPlatform::eX11,
+        InitHintPlatform::eNull,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Any",
+        "Win32",
+        "Cocoa",
+        "Wayland",
+        "X11",
+        "Null",
+    };
+    static constexpr std::array<std::uint16_t, 16> hashTable = {
+        5, 2, 0, 0, 4, 0, 0, 6, 1, 3, 0, 0, 0, 0, 0, 0,
+    };
+    static constexpr std::size_t index(InitHintPlatform value) noexcept {
+        switch (value) {
+            case InitHintPlatform::eAny: return 0;
+            case InitHintPlatform::eWin32: return 1;
+            case InitHintPlatform::eCocoa: return 2;
+            case InitHintPlatform::eWayland: return 3;
+            case InitHintPlatform::eX11: return 4;
+            case InitHintPlatform::eNull: return 5;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InitHintAnglePlatformType> {
+    static constexpr std::size_t count = 7;
+    static constexpr std::uint32_t hashSeed = 2;
+    static constexpr std::array<InitHintAnglePlatformType, count> values = {
+        InitHintAnglePlatformType::eNone,
+        InitHintAnglePlatformType::eOpengl,
+        InitHintAnglePlatformType::eOpengles,
+        InitHintAnglePlatformType::eD3D9,
+        InitHintAnglePlatformType::eD3D11,
+        InitHintAnglePlatformType::eVulkan,
+        InitHintAnglePlatformType::eMetal,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "None",
+        "Opengl",
+        "Opengles",
+        "D3D9",
+        "D3D11",
+        "Vulkan",
+        "Metal",
+    };
+    static constexpr std::array<std::uint16_t, 32> hashTable = {
+        0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 0, 5, 4, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0,
+    };
+    static constexpr std::size_t index(InitHintAnglePlatformType value) noexcept {
+        switch (value) {
+            case InitHintAnglePlatformType::eNone: return 0;
+            case InitHintAnglePlatformType::eOpengl: return 1;
+            case InitHintAnglePlatformType::eOpengles: return 2;
+            case InitHintAnglePlatformType::eD3D9: return 3;
+            case InitHintAnglePlatformType::eD3D11: return 4;
+            case InitHintAnglePlatformType::eVulkan: return 5;
+            case InitHintAnglePlatformType::eMetal: return 6;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<InitHintWaylandLibdecor> {
+    static constexpr std::size_t count = 2;
+    static constexpr std::uint32_t hashSeed = 1;
+    static constexpr std::array<InitHintWaylandLibdecor, count> values = {
+        InitHintWaylandLibdecor::ePrefer,
+        InitHintWaylandLibdecor::eDisable,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Prefer",
+        "Disable",
+    };
+    static constexpr std::array<std::uint16_t, 4> hashTable = {
+        2, 0, 1, 0,
+    };
+    static constexpr std::size_t index(InitHintWaylandLibdecor value) noexcept {
+        switch (value) {
+            case InitHintWaylandLibdecor::ePrefer: return 0;
+            case InitHintWaylandLibdecor::eDisable: return 1;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<CursorShape> {
+    static constexpr std::size_t count = 10;
+    static constexpr std::uint32_t hashSeed = 2;
+    static constexpr std::array<CursorShape, count> values = {
+        CursorShape::eArrow,
+        CursorShape::eIbeam,
+        CursorShape::eCrosshair,
+        CursorShape::ePointingHand,
+        CursorShape::eResizeEw,
+        CursorShape::eResizeNs,
+        CursorShape::eResizeNwse,
+        CursorShape::eResizeNesw,
+        CursorShape::eResizeAll,
+        CursorShape::eNotAllowed,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Arrow",
+        "Ibeam",
+        "Crosshair",
+        "PointingHand",
+        "ResizeEw",
+        "ResizeNs",
+        "ResizeNwse",
+        "ResizeNesw",
+        "ResizeAll",
+        "NotAllowed",
+    };
+    static constexpr std::array<std::uint16_t, 32> hashTable = {
+        0, 0, 0, 0, 1, 0, 0, 0, 7, 0, 9, 0, 8, 2, 0, 0,
+        6, 0, 0, 0, 4, 0, 0, 0, 10, 3, 0, 5, 0, 0, 0, 0,
+    };
+    static constexpr std::size_t index(CursorShape value) noexcept {
+        switch (value) {
+            case CursorShape::eArrow: return 0;
+            case CursorShape::eIbeam: return 1;
+            case CursorShape::eCrosshair: return 2;
+            case CursorShape::ePointingHand: return 3;
+            case CursorShape::eResizeEw: return 4;
+            case CursorShape::eResizeNs: return 5;
+            case CursorShape::eResizeNwse: return 6;
+            case CursorShape::eResizeNesw: return 7;
+            case CursorShape::eResizeAll: return 8;
+            case CursorShape::eNotAllowed: return 9;
+        }
+        return count;
+    }
+};
+
+template <> struct EnumTraits<JoystickEvent> {
+    static constexpr std::size_t count = 2;
+    static constexpr std::uint32_t hashSeed = 0;
+    static constexpr std::array<JoystickEvent, count> values = {
+        JoystickEvent::eConnected,
+        JoystickEvent::eDisconnected,
+    };
+    static constexpr std::array<std::string_view, count> names = {
+        "Connected",
+        "Disconnected",
+    };
+    static constexpr std::array<std::uint16_t, 4> hashTable = {
+        1, 0, 2, 0,
+    };
+    static constexpr std::size_t index(JoystickEvent value) noexcept {
+        switch (value) {
+            case JoystickEvent::eConnected: return 0;
+            case JoystickEvent::eDisconnected: return 1;
+        }
+        return count;
+    }
+};
+
+// !end_generated
+}
+
+#endif // GLFW_HPP_ENUMS_INCLUDED
@@ -0,0 +1,87 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Forward declarations of the glfw-hpp types, for headers that only pass them around.
+
+#ifndef GLFW_HPP_FWD_INCLUDED
+#define GLFW_HPP_FWD_INCLUDED
+
+#include "./glfw_enums.hpp"
+
+namespace GLFW_HPP_NAMESPACE {
+GLFW_HPP_EXPORT using VideoMode = ::GLFWvidmode;
+GLFW_HPP_EXPORT using GamepadState = ::GLFWgamepadstate;
+GLFW_HPP_EXPORT using Image = ::GLFWimage;
+GLFW_HPP_EXPORT using ProcAddress = void(*)();
+
+// !begin_generated
+// !generate_forward_declarations
+GLFW_HPP_EXPORT class GLFWException;
+GLFW_HPP_EXPORT struct Color;
+GLFW_HPP_EXPORT class Monitor;
+GLFW_HPP_EXPORT class Cursor;
+GLFW_HPP_EXPORT struct Extension;
+GLFW_HPP_EXPORT class Window;
+GLFW_HPP_EXPORT class Gamepad;
+GLFW_HPP_EXPORT class Joystick;
+GLFW_HPP_EXPORT struct InitInfo;
+GLFW_HPP_EXPORT struct WindowCreateInfo;
+GLFW_HPP_EXPORT struct ContextSwitchStats;
+#ifdef GLFW_HPP_ENABLE_PROFILING
+GLFW_HPP_EXPORT struct ProfileEntry;
+#endif
+#ifdef GLFW_HPP_ENABLE_TRACING
+GLFW_HPP_EXPORT class Tracer;
+GLFW_HPP_EXPORT class TraceScope;
+#endif
+#ifdef GLFW_HPP_ENABLE_PROFILING
+GLFW_HPP_EXPORT class ProfileScope;
+#endif
+GLFW_HPP_EXPORT struct ButtonTransitions;
+GLFW_HPP_EXPORT class JoystickTracker;
+GLFW_HPP_EXPORT struct AxisResponse;
+GLFW_HPP_EXPORT class AxisProcessor;
+GLFW_HPP_EXPORT class InputIndex;
+GLFW_HPP_EXPORT template <std::size_t MaxActions> class ActionMap;
+GLFW_HPP_EXPORT class KeyNameTable;
+GLFW_HPP_EXPORT class GamepadMappingDatabase;
+GLFW_HPP_EXPORT struct KeyChord;
+GLFW_HPP_EXPORT class ShortcutMatcher;
+GLFW_HPP_EXPORT struct FrameStats;
+GLFW_HPP_EXPORT class FramePacer;
+GLFW_HPP_EXPORT struct InputEvent;
+GLFW_HPP_EXPORT class FixedTimestepLoop;
+GLFW_HPP_EXPORT struct ProcEntry;
+GLFW_HPP_EXPORT template <typename Fn> struct Proc;
+GLFW_HPP_EXPORT template <std::size_t N> class ProcTable;
+GLFW_HPP_EXPORT class SharedContextPool;
+GLFW_HPP_EXPORT struct PresentTiming;
+GLFW_HPP_EXPORT class PresentScheduler;
+GLFW_HPP_EXPORT struct CursorCacheStats;
+GLFW_HPP_EXPORT class CursorCache;
+GLFW_HPP_EXPORT class ImageBuffer;
+GLFW_HPP_EXPORT class IconSet;
+// !end_generated
+}
+
+#endif // GLFW_HPP_FWD_INCLUDED
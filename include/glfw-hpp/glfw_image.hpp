@@ -0,0 +1,545 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Pixel buffers, icon sets and a cursor cache for images handed to GLFW.
+
+#ifndef GLFW_HPP_IMAGE_INCLUDED
+#define GLFW_HPP_IMAGE_INCLUDED
+
+#include "./glfw.hpp"
+
+#ifndef GLFW_HPP_MODULE
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <new>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef GLFW_HPP_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+// Fast non-cryptographic hash of an image's size and RGBA pixels
+GLFW_HPP_API_NODISCARD std::uint64_t imageHash(const Image& image) noexcept {
+    constexpr std::uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+    auto mix = [](std::uint64_t hash, std::uint64_t value) noexcept {
+        hash = (hash ^ value) * kMultiplier;
+        return hash ^ (hash >> 29);
+    };
+
+    std::uint64_t hash = mix(static_cast<std::uint32_t>(image.width), static_cast<std::uint32_t>(image.height));
+    std::size_t size = static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height) * 4;
+    const unsigned char* pixels = image.pixels;
+    std::size_t offset = 0;
+    for (; offset + 8 <= size; offset += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, pixels + offset, sizeof(word));
+        hash = mix(hash, word);
+    }
+    std::uint64_t tail = 0;
+    if (offset < size) {
+        std::memcpy(&tail, pixels + offset, size - offset);
+    }
+    return mix(hash, tail ^ size);
+}
+
+GLFW_HPP_EXPORT struct CursorCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+};
+
+// Custom cursors keyed by image content and hotspot, so an image is uploaded only once.
+// Entries are evicted least recently used first once either limit is exceeded; a limit
+// of 0 means unbounded. Handles are shared, so an evicted cursor stays alive until its
+// last handle is dropped. Every handle must be released before `terminate()`.
+GLFW_HPP_EXPORT class CursorCache {
+public:
+    using Handle = std::shared_ptr<const Cursor>;
+
+private:
+    struct Entry {
+        std::uint64_t key;
+        int width;
+        int height;
+        int xhot;
+        int yhot;
+        std::vector<unsigned char> pixels;
+        Handle cursor;
+    };
+
+    std::list<Entry> m_entries;
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> m_index;
+    std::size_t m_maxEntries;
+    std::size_t m_maxBytes;
+    CursorCacheStats m_stats;
+
+    static std::uint64_t key(const Image& image, int xhot, int yhot) noexcept {
+        std::uint64_t hotspot = static_cast<std::uint64_t>(static_cast<std::uint32_t>(xhot)) << 32 |
+                                static_cast<std::uint32_t>(yhot);
+        return imageHash(image) ^ (hotspot * 0xC2B2AE3D27D4EB4Full);
+    }
+
+    static bool matches(const Entry& entry, const Image& image, int xhot, int yhot) noexcept {
+        return entry.width == image.width && entry.height == image.height && entry.xhot == xhot &&
+               entry.yhot == yhot && std::memcmp(entry.pixels.data(), image.pixels, entry.pixels.size()) == 0;
+    }
+
+    static Handle share(Cursor cursor) {
+        return Handle{new Cursor{cursor}, [](const Cursor* cursor) {
+                          Cursor{*cursor}.destroy();
+                          delete cursor;
+                      }};
+    }
+
+    void trim() {
+        while (m_entries.size() > 1 && ((m_maxEntries != 0 && m_entries.size() > m_maxEntries) ||
+                                           (m_maxBytes != 0 && m_stats.bytes > m_maxBytes))) {
+            Entry& victim = m_entries.back();
+            m_stats.bytes -= victim.pixels.size();
+            m_stats.evictions += 1;
+            m_index.erase(victim.key);
+            m_entries.pop_back();
+        }
+        m_stats.entries = m_entries.size();
+    }
+
+public:
+    explicit CursorCache(std::size_t maxEntries = 64, std::size_t maxBytes = 0) noexcept
+        : m_maxEntries(maxEntries), m_maxBytes(maxBytes) {}
+
+    CursorCache(const CursorCache&) = delete;
+    CursorCache& operator=(const CursorCache&) = delete;
+
+    // Returns the cached cursor for the image and hotspot, creating it on a miss
+    GLFW_HPP_NODISCARD Handle get(const Image& image, int xhot, int yhot) {
+        std::uint64_t hash = key(image, xhot, yhot);
+        auto it = m_index.find(hash);
+        if (it != m_index.end()) {
+            if (matches(*it->second, image, xhot, yhot)) {
+                m_stats.hits += 1;
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                return it->second->cursor;
+            }
+            // Hash collision: hand out an uncached cursor rather than evict a live entry
+            m_stats.misses += 1;
+            return share(createCursor(image, xhot, yhot));
+        }
+
+        m_stats.misses += 1;
+        Handle cursor = share(createCursor(image, xhot, yhot));
+        std::size_t size = static_cast<std::size_t>(image.width) * static_cast<std::size_t>(image.height) * 4;
+        m_entries.push_front({hash, image.width, image.height, xhot, yhot, {image.pixels, image.pixels + size}, cursor});
+        m_index.emplace(hash, m_entries.begin());
+        m_stats.bytes += size;
+        trim();
+        return cursor;
+    }
+
+    void setLimits(std::size_t maxEntries, std::size_t maxBytes) {
+        m_maxEntries = maxEntries;
+        m_maxBytes = maxBytes;
+        trim();
+    }
+
+    void clear() noexcept {
+        m_index.clear();
+        m_entries.clear();
+        m_stats.entries = 0;
+        m_stats.bytes = 0;
+    }
+
+    GLFW_HPP_NODISCARD CursorCacheStats stats() const noexcept {
+        return m_stats;
+    }
+};
+
+// Owning 8-bit RGBA pixel buffer, 16-byte aligned, that can be passed wherever GLFW expects
+// an `Image` or a span of images. The views point into the buffer, so moving it invalidates them.
+GLFW_HPP_EXPORT class ImageBuffer {
+private:
+    static constexpr std::align_val_t kAlignment{16};
+
+    struct Deleter {
+        void operator()(unsigned char* pixels) const noexcept {
+            ::operator delete(pixels, kAlignment);
+        }
+    };
+
+    std::unique_ptr<unsigned char[], Deleter> m_pixels;
+    Image m_image{};
+
+    static unsigned char* allocate(std::size_t size) {
+        return static_cast<unsigned char*>(::operator new(size == 0 ? 1 : size, kAlignment));
+    }
+
+    static std::size_t byteSize(int width, int height) noexcept {
+        return static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4;
+    }
+
+public:
+    ImageBuffer() = default;
+
+    ImageBuffer(int width, int height) : m_pixels(allocate(byteSize(width, height))) {
+        std::memset(m_pixels.get(), 0, byteSize(width, height));
+        m_image = {width, height, m_pixels.get()};
+    }
+
+    ImageBuffer(ImageBuffer&& that) noexcept : m_pixels(std::move(that.m_pixels)), m_image(that.m_image) {
+        that.m_image = {};
+    }
+
+    ImageBuffer& operator=(ImageBuffer&& that) noexcept {
+        if (this != &that) {
+            m_pixels = std::move(that.m_pixels);
+            m_image = that.m_image;
+            that.m_image = {};
+        }
+        return *this;
+    }
+
+    ImageBuffer(const ImageBuffer&) = delete;
+    ImageBuffer& operator=(const ImageBuffer&) = delete;
+
+    GLFW_HPP_NODISCARD static ImageBuffer fromRGBA(const unsigned char* pixels, int width, int height) {
+        ImageBuffer buffer{width, height};
+        std::memcpy(buffer.m_pixels.get(), pixels, byteSize(width, height));
+        return buffer;
+    }
+
+    GLFW_HPP_NODISCARD static ImageBuffer fromBGRA(const unsigned char* pixels, int width, int height) {
+        ImageBuffer buffer = fromRGBA(pixels, width, height);
+        buffer.swapRedBlue();
+        return buffer;
+    }
+
+    GLFW_HPP_NODISCARD static ImageBuffer fromPremultipliedRGBA(const unsigned char* pixels, int width, int height) {
+        ImageBuffer buffer = fromRGBA(pixels, width, height);
+        buffer.unpremultiply();
+        return buffer;
+    }
+
+    // Expands one byte per pixel to opaque gray RGBA
+    GLFW_HPP_NODISCARD static ImageBuffer fromGrayscale(const unsigned char* pixels, int width, int height) {
+        ImageBuffer buffer{width, height};
+        std::size_t count = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        unsigned char* out = buffer.m_pixels.get();
+        std::size_t i = 0;
+#ifdef GLFW_HPP_SSE2
+        __m128i opaque = _mm_set1_epi8(static_cast<char>(0xFF));
+        for (; i + 16 <= count; i += 16) {
+            __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+            __m128i grayLo = _mm_unpacklo_epi8(gray, gray);
+            __m128i grayHi = _mm_unpackhi_epi8(gray, gray);
+            __m128i alphaLo = _mm_unpacklo_epi8(gray, opaque);
+            __m128i alphaHi = _mm_unpackhi_epi8(gray, opaque);
+            auto dst = reinterpret_cast<__m128i*>(out + i * 4);
+            _mm_store_si128(dst + 0, _mm_unpacklo_epi16(grayLo, alphaLo));
+            _mm_store_si128(dst + 1, _mm_unpackhi_epi16(grayLo, alphaLo));
+            _mm_store_si128(dst + 2, _mm_unpacklo_epi16(grayHi, alphaHi));
+            _mm_store_si128(dst + 3, _mm_unpackhi_epi16(grayHi, alphaHi));
+        }
+#endif
+        for (; i < count; ++i) {
+            out[i * 4 + 0] = pixels[i];
+            out[i * 4 + 1] = pixels[i];
+            out[i * 4 + 2] = pixels[i];
+            out[i * 4 + 3] = 0xFF;
+        }
+        return buffer;
+    }
+
+    // Swaps the red and blue channels, converting between BGRA and RGBA in place
+    void swapRedBlue() noexcept {
+        std::size_t count = byteSize(m_image.width, m_image.height) / 4;
+        unsigned char* pixels = m_pixels.get();
+        std::size_t i = 0;
+#ifdef GLFW_HPP_SSE2
+        __m128i keep = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+        __m128i low = _mm_set1_epi32(0xFF);
+        for (; i + 4 <= count; i += 4) {
+            auto ptr = reinterpret_cast<__m128i*>(pixels + i * 4);
+            __m128i value = _mm_load_si128(ptr);
+            __m128i red = _mm_slli_epi32(_mm_and_si128(value, low), 16);
+            __m128i blue = _mm_and_si128(_mm_srli_epi32(value, 16), low);
+            _mm_store_si128(ptr, _mm_or_si128(_mm_and_si128(value, keep), _mm_or_si128(red, blue)));
+        }
+#endif
+        for (; i < count; ++i) {
+            std::swap(pixels[i * 4 + 0], pixels[i * 4 + 2]);
+        }
+    }
+
+    // Divides color channels by alpha, rounding to nearest; fully transparent pixels become
+    // transparent black. Both paths compute min(255, (c * 255 + a / 2) / a) exactly.
+    void unpremultiply() noexcept {
+        std::size_t count = byteSize(m_image.width, m_image.height) / 4;
+        unsigned char* pixels = m_pixels.get();
+        std::size_t i = 0;
+#ifdef GLFW_HPP_SSE2
+        __m128i zero = _mm_setzero_si128();
+        __m128i colorMask = _mm_set_epi32(0, -1, -1, -1);
+        __m128 max = _mm_set1_ps(255.0f);
+        // The numerator is an exact integer in float and the quotient is never within
+        // float error of the next integer when c <= a, so truncating matches integer division
+        auto convert = [&](__m128i pixel) noexcept {
+            __m128i alphaBits = _mm_shuffle_epi32(pixel, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128 alpha = _mm_cvtepi32_ps(alphaBits);
+            __m128 numerator = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(pixel), max), _mm_cvtepi32_ps(_mm_srli_epi32(alphaBits, 1)));
+            __m128 quotient = _mm_and_ps(_mm_min_ps(_mm_div_ps(numerator, alpha), max), _mm_cmpneq_ps(alpha, _mm_setzero_ps()));
+            __m128i color = _mm_cvttps_epi32(quotient);
+            return _mm_or_si128(_mm_and_si128(colorMask, color), _mm_andnot_si128(colorMask, pixel));
+        };
+        for (; i + 4 <= count; i += 4) {
+            auto ptr = reinterpret_cast<__m128i*>(pixels + i * 4);
+            __m128i value = _mm_load_si128(ptr);
+            __m128i lo = _mm_unpacklo_epi8(value, zero);
+            __m128i hi = _mm_unpackhi_epi8(value, zero);
+            __m128i first = _mm_packs_epi32(convert(_mm_unpacklo_epi16(lo, zero)), convert(_mm_unpackhi_epi16(lo, zero)));
+            __m128i second = _mm_packs_epi32(convert(_mm_unpacklo_epi16(hi, zero)), convert(_mm_unpackhi_epi16(hi, zero)));
+            _mm_store_si128(ptr, _mm_packus_epi16(first, second));
+        }
+#endif
+        for (; i < count; ++i) {
+            unsigned char* pixel = pixels + i * 4;
+            unsigned alpha = pixel[3];
+            for (int c = 0; c < 3; ++c) {
+                pixel[c] = alpha == 0 ? 0 : static_cast<unsigned char>(std::min(255u, (pixel[c] * 255u + alpha / 2) / alpha));
+            }
+        }
+    }
+
+    GLFW_HPP_NODISCARD int width() const noexcept {
+        return m_image.width;
+    }
+
+    GLFW_HPP_NODISCARD int height() const noexcept {
+        return m_image.height;
+    }
+
+    GLFW_HPP_NODISCARD std::span<unsigned char> pixels() noexcept {
+        return {m_pixels.get(), byteSize(m_image.width, m_image.height)};
+    }
+
+    GLFW_HPP_NODISCARD std::span<const unsigned char> pixels() const noexcept {
+        return {m_pixels.get(), byteSize(m_image.width, m_image.height)};
+    }
+
+    GLFW_HPP_NODISCARD const Image& image() const noexcept {
+        return m_image;
+    }
+
+    GLFW_HPP_NODISCARD std::span<const GLFWimage> images() const noexcept {
+        return {&m_image, m_pixels ? 1u : 0u};
+    }
+
+    operator const Image&() const noexcept {
+        return m_image;
+    }
+
+    operator std::span<const GLFWimage>() const noexcept {
+        return images();
+    }
+};
+
+// Downscaled copies of one source image at the usual icon sizes, stored in one arena.
+// Pixels are averaged with an area-weighted box filter in premultiplied alpha, so
+// transparent pixels do not darken edges. A non-square source is cropped to the centered
+// square of its shorter side, and sizes larger than that side are skipped.
+// Build once and pass to `Window::setIcon()` for every window.
+GLFW_HPP_EXPORT class IconSet {
+public:
+    static constexpr std::array<int, 6> kDefaultSizes = {16, 32, 48, 64, 128, 256};
+
+private:
+    struct Tap {
+        int index;
+        float weight;
+    };
+
+    std::vector<unsigned char> m_arena;
+    std::vector<GLFWimage> m_images;
+
+    // Source pixels covering each destination pixel along one axis, with weights summing to 1
+    static void taps(int source, int target, std::vector<int>& offsets, std::vector<Tap>& taps) {
+        offsets.assign(1, 0);
+        taps.clear();
+        double scale = static_cast<double>(source) / target;
+        for (int i = 0; i < target; ++i) {
+            double begin = i * scale;
+            double end = begin + scale;
+            for (int j = static_cast<int>(begin); j < source && j < end; ++j) {
+                double coverage = std::min<double>(end, j + 1) - std::max<double>(begin, j);
+                if (coverage > 0.0) {
+                    taps.push_back({j, static_cast<float>(coverage / scale)});
+                }
+            }
+            offsets.push_back(static_cast<int>(taps.size()));
+        }
+    }
+
+    static void accumulate(float* dst, const float* src, float weight) noexcept {
+#ifdef GLFW_HPP_SSE2
+        _mm_store_ps(dst, _mm_add_ps(_mm_load_ps(dst), _mm_mul_ps(_mm_load_ps(src), _mm_set1_ps(weight))));
+#else
+        for (int c = 0; c < 4; ++c) {
+            dst[c] += src[c] * weight;
+        }
+#endif
+    }
+
+    // Both paths round by adding 0.5 and truncating, so they produce the same bytes
+    static void storePixel(unsigned char* dst, const float* src) noexcept {
+#ifdef GLFW_HPP_SSE2
+        __m128 value = _mm_load_ps(src);
+        __m128 alpha = _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 colorMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        __m128 visible = _mm_cmpgt_ps(alpha, _mm_set1_ps(1e-6f));
+        __m128 color = _mm_and_ps(_mm_mul_ps(_mm_div_ps(value, alpha), _mm_set1_ps(255.0f)), visible);
+        __m128 result = _mm_or_ps(_mm_and_ps(colorMask, color), _mm_andnot_ps(colorMask, _mm_mul_ps(value, _mm_set1_ps(255.0f))));
+        result = _mm_min_ps(_mm_max_ps(result, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+        __m128i packed = _mm_packs_epi32(_mm_cvttps_epi32(_mm_add_ps(result, _mm_set1_ps(0.5f))), _mm_setzero_si128());
+        int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+        std::memcpy(dst, &bytes, 4);
+#else
+        float alpha = src[3];
+        for (int c = 0; c < 3; ++c) {
+            float color = alpha > 1e-6f ? src[c] / alpha * 255.0f : 0.0f;
+            dst[c] = static_cast<unsigned char>(std::clamp(color, 0.0f, 255.0f) + 0.5f);
+        }
+        dst[3] = static_cast<unsigned char>(std::clamp(alpha * 255.0f, 0.0f, 255.0f) + 0.5f);
+#endif
+    }
+
+public:
+    IconSet() = default;
+
+    // The images point into the arena; moving keeps the buffer, copying would not
+    IconSet(IconSet&&) noexcept = default;
+    IconSet& operator=(IconSet&&) noexcept = default;
+    IconSet(const IconSet&) = delete;
+    IconSet& operator=(const IconSet&) = delete;
+
+    explicit IconSet(const Image& source, std::span<const int> sizes = kDefaultSizes) {
+        build(source, sizes);
+    }
+
+    void build(const Image& source, std::span<const int> sizes = kDefaultSizes) {
+        m_arena.clear();
+        m_images.clear();
+
+        int side = std::min(source.width, source.height);
+        std::size_t arenaSize = 0;
+        for (int size : sizes) {
+            if (size > 0 && size <= side) {
+                arenaSize += static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * 4;
+            }
+        }
+        if (arenaSize == 0) {
+            return;
+        }
+        m_arena.resize(arenaSize);
+
+        struct alignas(16) Pixel {
+            float value[4];
+        };
+        int left = (source.width - side) / 2;
+        int top = (source.height - side) / 2;
+        std::vector<Pixel> premultiplied(static_cast<std::size_t>(side) * static_cast<std::size_t>(side));
+        for (int y = 0; y < side; ++y) {
+            const unsigned char* row = source.pixels + (static_cast<std::size_t>(top + y) * source.width + left) * 4;
+            Pixel* dst = premultiplied.data() + static_cast<std::size_t>(y) * side;
+            for (int x = 0; x < side; ++x) {
+                const unsigned char* pixel = row + x * 4;
+                float alpha = pixel[3] / 255.0f;
+                dst[x] = {{pixel[0] / 255.0f * alpha, pixel[1] / 255.0f * alpha, pixel[2] / 255.0f * alpha, alpha}};
+            }
+        }
+
+        // The crop is square, so rows and columns share one set of taps
+        std::vector<int> offsets;
+        std::vector<Tap> weights;
+        std::vector<Pixel> rows;
+        Pixel sum;
+        std::size_t offset = 0;
+        for (int size : sizes) {
+            if (size <= 0 || size > side) {
+                continue;
+            }
+            taps(side, size, offsets, weights);
+
+            // Horizontal pass: every cropped row shrunk to `size` columns
+            rows.assign(static_cast<std::size_t>(side) * size, Pixel{});
+            for (int y = 0; y < side; ++y) {
+                const Pixel* src = premultiplied.data() + static_cast<std::size_t>(y) * side;
+                Pixel* dst = rows.data() + static_cast<std::size_t>(y) * size;
+                for (int x = 0; x < size; ++x) {
+                    for (int t = offsets[x]; t < offsets[x + 1]; ++t) {
+                        accumulate(dst[x].value, src[weights[t].index].value, weights[t].weight);
+                    }
+                }
+            }
+
+            // Vertical pass straight into the arena
+            unsigned char* out = m_arena.data() + offset;
+            for (int y = 0; y < size; ++y) {
+                for (int x = 0; x < size; ++x) {
+                    sum = {};
+                    for (int t = offsets[y]; t < offsets[y + 1]; ++t) {
+                        accumulate(sum.value, rows[static_cast<std::size_t>(weights[t].index) * size + x].value, weights[t].weight);
+                    }
+                    storePixel(out + (static_cast<std::size_t>(y) * size + x) * 4, sum.value);
+                }
+            }
+
+            m_images.push_back({size, size, out});
+            offset += static_cast<std::size_t>(size) * static_cast<std::size_t>(size) * 4;
+        }
+    }
+
+    GLFW_HPP_NODISCARD bool empty() const noexcept {
+        return m_images.empty();
+    }
+
+    GLFW_HPP_NODISCARD std::span<const GLFWimage> images() const noexcept {
+        return m_images;
+    }
+
+    operator std::span<const GLFWimage>() const noexcept {
+        return m_images;
+    }
+};
+}
+
+#endif // GLFW_HPP_IMAGE_INCLUDED
@@ -0,0 +1,1223 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Input utilities built on the wrapper classes: joystick edge tracking, axis response
+// curves, action maps, key name tables, gamepad mapping databases and shortcut matching.
+
+#ifndef GLFW_HPP_INPUT_INCLUDED
+#define GLFW_HPP_INPUT_INCLUDED
+
+#include "./glfw.hpp"
+
+#ifndef GLFW_HPP_MODULE
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef GLFW_HPP_SSE2
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+GLFW_HPP_EXPORT struct ButtonTransitions {
+    std::uint64_t pressed = 0;
+    std::uint64_t released = 0;
+    std::uint64_t held = 0;
+
+    // Indices outside the 64 tracked bits are never set
+    GLFW_HPP_NODISCARD static constexpr bool test(std::uint64_t mask, int index) noexcept {
+        return index >= 0 && index < 64 && ((mask >> index) & 1) != 0;
+    }
+
+    GLFW_HPP_NODISCARD bool isPressed(int index) const noexcept {
+        return test(pressed, index);
+    }
+
+    GLFW_HPP_NODISCARD bool isReleased(int index) const noexcept {
+        return test(released, index);
+    }
+
+    GLFW_HPP_NODISCARD bool isHeld(int index) const noexcept {
+        return test(held, index);
+    }
+
+    GLFW_HPP_NODISCARD bool isPressed(GamepadButton button) const noexcept {
+        return isPressed(static_cast<int>(button));
+    }
+
+    GLFW_HPP_NODISCARD bool isReleased(GamepadButton button) const noexcept {
+        return isReleased(static_cast<int>(button));
+    }
+
+    GLFW_HPP_NODISCARD bool isHeld(GamepadButton button) const noexcept {
+        return isHeld(static_cast<int>(button));
+    }
+
+    // Hats are packed four bits per hat, in the order of `Joystick::hats()`; only the
+    // first 16 hats are tracked and later ones give an empty mask
+    GLFW_HPP_NODISCARD static constexpr std::uint64_t hatMask(int hat, HatState state) noexcept {
+        if (hat < 0 || hat >= 16) {
+            return 0;
+        }
+        return static_cast<std::uint64_t>(state) << (hat * 4);
+    }
+};
+
+// Double-buffered button and hat state for every joystick slot.
+// Each `update()` samples all slots and derives pressed/released/held bitmasks
+// for every pad at once, so per-frame queries are plain bit tests.
+GLFW_HPP_EXPORT class JoystickTracker {
+public:
+    static constexpr int kMaxJoysticks = GLFW_JOYSTICK_LAST + 1;
+    static constexpr int kMaxButtons = 64;
+    static constexpr int kMaxHats = 16;
+
+private:
+    enum Lane {
+        eButtons,
+        eHats,
+        eGamepadButtons,
+        eLaneCount,
+    };
+
+    static constexpr int kWords = kMaxJoysticks * eLaneCount;
+
+    alignas(16) std::uint64_t m_state[2][kWords] = {};
+    alignas(16) std::uint64_t m_pressed[kWords] = {};
+    alignas(16) std::uint64_t m_released[kWords] = {};
+    alignas(16) std::uint64_t m_held[kWords] = {};
+    int m_current = 0;
+
+    static std::uint64_t packButtons(std::span<const unsigned char> buttons) noexcept {
+        std::size_t count = buttons.size() < kMaxButtons ? buttons.size() : kMaxButtons;
+#ifdef GLFW_HPP_SSE2
+        alignas(16) unsigned char padded[kMaxButtons] = {};
+        if (count != 0) {
+            std::memcpy(padded, buttons.data(), count);
+        }
+        std::uint64_t mask = 0;
+        __m128i released = _mm_set1_epi8(GLFW_RELEASE);
+        for (int i = 0; i < kMaxButtons; i += 16) {
+            __m128i chunk = _mm_load_si128(reinterpret_cast<const __m128i*>(padded + i));
+            auto bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, released)));
+            mask |= static_cast<std::uint64_t>(~bits & 0xFFFFu) << i;
+        }
+        return mask;
+#else
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            mask |= static_cast<std::uint64_t>(buttons[i] != GLFW_RELEASE) << i;
+        }
+        return mask;
+#endif
+    }
+
+    static std::uint64_t packHats(std::span<const unsigned char> hats) noexcept {
+        std::size_t count = hats.size() < kMaxHats ? hats.size() : kMaxHats;
+        std::uint64_t mask = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            mask |= static_cast<std::uint64_t>(hats[i] & 0xF) << (i * 4);
+        }
+        return mask;
+    }
+
+    GLFW_HPP_NODISCARD ButtonTransitions transitions(int joystick, Lane lane) const noexcept {
+        if (joystick < 0 || joystick >= kMaxJoysticks) {
+            return {};
+        }
+        int word = joystick * eLaneCount + lane;
+        return {m_pressed[word], m_released[word], m_held[word]};
+    }
+
+public:
+    // Samples every joystick slot through GLFW and commits the new state
+    void update() {
+        for (int jid = 0; jid < kMaxJoysticks; ++jid) {
+            Joystick joystick{jid};
+            if (!joystick.isPresent()) {
+                continue;
+            }
+            std::span<const unsigned char> gamepadButtons;
+            GamepadState state{};
+            if (Gamepad gamepad = joystick.gamepad()) {
+                state = gamepad.state();
+                gamepadButtons = state.buttons;
+            }
+            record(jid, joystick.buttons(), joystick.hats(), gamepadButtons);
+        }
+        commit();
+    }
+
+    // Stores the state of one slot for the next `commit()`.
+    // Slots that are not recorded before the commit are treated as disconnected.
+    void record(
+        int joystick,
+        std::span<const unsigned char> buttons,
+        std::span<const unsigned char> hats,
+        std::span<const unsigned char> gamepadButtons = {}
+    ) noexcept {
+        if (joystick < 0 || joystick >= kMaxJoysticks) {
+            return;
+        }
+        std::uint64_t* next = m_state[m_current ^ 1] + joystick * eLaneCount;
+        next[eButtons] = packButtons(buttons);
+        next[eHats] = packHats(hats);
+        next[eGamepadButtons] = packButtons(gamepadButtons);
+    }
+
+    // Compares the recorded state against the previous one for all slots at once
+    void commit() noexcept {
+        const std::uint64_t* prev = m_state[m_current];
+        const std::uint64_t* cur = m_state[m_current ^ 1];
+#ifdef GLFW_HPP_SSE2
+        for (int i = 0; i < kWords; i += 2) {
+            __m128i p = _mm_load_si128(reinterpret_cast<const __m128i*>(prev + i));
+            __m128i c = _mm_load_si128(reinterpret_cast<const __m128i*>(cur + i));
+            _mm_store_si128(reinterpret_cast<__m128i*>(m_pressed + i), _mm_andnot_si128(p, c));
+            _mm_store_si128(reinterpret_cast<__m128i*>(m_released + i), _mm_andnot_si128(c, p));
+            _mm_store_si128(reinterpret_cast<__m128i*>(m_held + i), _mm_and_si128(c, p));
+        }
+#else
+        for (int i = 0; i < kWords; ++i) {
+            m_pressed[i] = cur[i] & ~prev[i];
+            m_released[i] = prev[i] & ~cur[i];
+            m_held[i] = cur[i] & prev[i];
+        }
+#endif
+        m_current ^= 1;
+        std::memset(m_state[m_current ^ 1], 0, sizeof(m_state[0]));
+    }
+
+    GLFW_HPP_NODISCARD ButtonTransitions buttons(Joystick joystick) const noexcept {
+        return transitions(joystick.id(), eButtons);
+    }
+
+    GLFW_HPP_NODISCARD ButtonTransitions hats(Joystick joystick) const noexcept {
+        return transitions(joystick.id(), eHats);
+    }
+
+    GLFW_HPP_NODISCARD ButtonTransitions gamepadButtons(Joystick joystick) const noexcept {
+        return transitions(joystick.id(), eGamepadButtons);
+    }
+
+    GLFW_HPP_NODISCARD ButtonTransitions gamepadButtons(Gamepad gamepad) const noexcept {
+        return transitions(gamepad.handle(), eGamepadButtons);
+    }
+};
+
+// Response of a single axis. Axes are treated as centered at zero; an axis
+// with `pairedAxis` set uses the radial magnitude of both axes instead of its own.
+GLFW_HPP_EXPORT struct AxisResponse {
+    float deadzone = 0.0f;
+    float saturation = 1.0f;
+    float antiDeadzone = 0.0f;
+    float expo = 0.0f;
+    int pairedAxis = -1;
+};
+
+// Applies deadzones and response curves to the axes of all connected joysticks.
+// Responses are configured per joystick GUID and per axis, and resolved into flat
+// parameter arrays when a joystick connects, so `process()` is a single SIMD pass.
+// Only the first `kMaxAxes` axes of each joystick are processed; further axes are ignored.
+GLFW_HPP_EXPORT class AxisProcessor {
+public:
+    static constexpr int kMaxJoysticks = GLFW_JOYSTICK_LAST + 1;
+    static constexpr int kMaxAxes = 8;
+    static constexpr std::size_t kOutputSize = kMaxJoysticks * kMaxAxes;
+
+private:
+    using Profile = std::array<std::optional<AxisResponse>, kMaxAxes>;
+
+    std::map<std::string, Profile, std::less<>> m_profiles;
+    std::array<AxisResponse, kMaxAxes> m_defaults{};
+    std::array<bool, kMaxJoysticks> m_resolved{};
+    // GUID each slot was resolved for, since another device can reconnect into the same
+    // slot between two `process()` calls
+    std::array<std::string, kMaxJoysticks> m_guids;
+
+    alignas(16) float m_input[kOutputSize] = {};
+    alignas(16) float m_partnerInput[kOutputSize] = {};
+    alignas(16) float m_deadzone[kOutputSize] = {};
+    alignas(16) float m_invRange[kOutputSize] = {};
+    alignas(16) float m_antiDeadzone[kOutputSize] = {};
+    alignas(16) float m_expo[kOutputSize] = {};
+    std::int8_t m_partner[kOutputSize] = {};
+
+    void resolve(int joystick, std::string_view guid) {
+        const Profile* profile = nullptr;
+        if (auto it = m_profiles.find(guid); it != m_profiles.end()) {
+            profile = &it->second;
+        }
+        for (int axis = 0; axis < kMaxAxes; ++axis) {
+            AxisResponse response = m_defaults[axis];
+            if (profile && (*profile)[axis]) {
+                response = *(*profile)[axis];
+            }
+            std::size_t i = joystick * kMaxAxes + axis;
+            float range = response.saturation - response.deadzone;
+            m_deadzone[i] = response.deadzone;
+            m_invRange[i] = range > 0.0f ? 1.0f / range : 0.0f;
+            m_antiDeadzone[i] = response.antiDeadzone;
+            m_expo[i] = response.expo;
+            bool paired = response.pairedAxis >= 0 && response.pairedAxis < kMaxAxes && response.pairedAxis != axis;
+            m_partner[i] = static_cast<std::int8_t>(paired ? response.pairedAxis : -1);
+        }
+        m_guids[joystick] = guid;
+        m_resolved[joystick] = true;
+    }
+
+    void resolveIfChanged(int joystick, std::string_view guid) {
+        if (!m_resolved[joystick] || m_guids[joystick] != guid) {
+            resolve(joystick, guid);
+        }
+    }
+
+    void unresolveAll() noexcept {
+        m_resolved.fill(false);
+    }
+
+    void loadSlot(int joystick, std::span<const float> axes) noexcept {
+        float* input = m_input + joystick * kMaxAxes;
+        std::size_t count = axes.size() < kMaxAxes ? axes.size() : kMaxAxes;
+        for (std::size_t axis = 0; axis < kMaxAxes; ++axis) {
+            input[axis] = axis < count ? axes[axis] : 0.0f;
+        }
+    }
+
+    void clearSlot(int joystick) noexcept {
+        std::fill_n(m_input + joystick * kMaxAxes, kMaxAxes, 0.0f);
+        m_resolved[joystick] = false;
+    }
+
+    void run(std::span<float> output) noexcept {
+        for (std::size_t i = 0; i < kOutputSize; ++i) {
+            int partner = m_partner[i];
+            m_partnerInput[i] = partner >= 0 ? m_input[i - i % kMaxAxes + partner] : 0.0f;
+        }
+
+        std::size_t count = output.size() < kOutputSize ? output.size() : kOutputSize;
+        std::size_t i = 0;
+#ifdef GLFW_HPP_SSE2
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 tiny = _mm_set1_ps(1e-12f);
+        for (; i + 4 <= count; i += 4) {
+            __m128 x = _mm_load_ps(m_input + i);
+            __m128 y = _mm_load_ps(m_partnerInput + i);
+            __m128 magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+            __m128 t = _mm_mul_ps(_mm_sub_ps(magnitude, _mm_load_ps(m_deadzone + i)), _mm_load_ps(m_invRange + i));
+            t = _mm_min_ps(_mm_max_ps(t, zero), one);
+            __m128 expo = _mm_load_ps(m_expo + i);
+            __m128 curved = _mm_mul_ps(t, _mm_add_ps(_mm_sub_ps(one, expo), _mm_mul_ps(expo, _mm_mul_ps(t, t))));
+            __m128 anti = _mm_load_ps(m_antiDeadzone + i);
+            __m128 response = _mm_add_ps(anti, _mm_mul_ps(_mm_sub_ps(one, anti), curved));
+            __m128 scale = _mm_div_ps(response, _mm_max_ps(magnitude, tiny));
+            __m128 active = _mm_cmpgt_ps(t, zero);
+            _mm_storeu_ps(output.data() + i, _mm_and_ps(active, _mm_mul_ps(x, scale)));
+        }
+#endif
+        for (; i < count; ++i) {
+            float x = m_input[i];
+            float y = m_partnerInput[i];
+            float magnitude = std::sqrt(x * x + y * y);
+            float t = std::clamp((magnitude - m_deadzone[i]) * m_invRange[i], 0.0f, 1.0f);
+            float curved = t * ((1.0f - m_expo[i]) + m_expo[i] * t * t);
+            float response = m_antiDeadzone[i] + (1.0f - m_antiDeadzone[i]) * curved;
+            output[i] = t > 0.0f ? x * response / std::max(magnitude, 1e-12f) : 0.0f;
+        }
+    }
+
+public:
+    void setDefaultResponse(int axis, const AxisResponse& response) {
+        if (axis >= 0 && axis < kMaxAxes) {
+            m_defaults[axis] = response;
+            unresolveAll();
+        }
+    }
+
+    void setResponse(std::string_view guid, int axis, const AxisResponse& response) {
+        if (axis < 0 || axis >= kMaxAxes) {
+            return;
+        }
+        auto it = m_profiles.find(guid);
+        if (it == m_profiles.end()) {
+            it = m_profiles.emplace(std::string{guid}, Profile{}).first;
+        }
+        it->second[axis] = response;
+        unresolveAll();
+    }
+
+    void setResponse(std::string_view guid, GamepadAxis axis, const AxisResponse& response) {
+        setResponse(guid, static_cast<int>(axis), response);
+    }
+
+    void clearResponses(std::string_view guid) {
+        if (auto it = m_profiles.find(guid); it != m_profiles.end()) {
+            m_profiles.erase(it);
+            unresolveAll();
+        }
+    }
+
+    // Processes `Joystick::axes()` of every connected joystick.
+    // Axis `i` of joystick `jid` is written to `output[jid * kMaxAxes + i]`.
+    void process(std::span<float> output) {
+        for (int jid = 0; jid < kMaxJoysticks; ++jid) {
+            Joystick joystick{jid};
+            if (!joystick.isPresent()) {
+                clearSlot(jid);
+                continue;
+            }
+            resolveIfChanged(jid, joystick.guid());
+            loadSlot(jid, joystick.axes());
+        }
+        run(output);
+    }
+
+    // Same as `process()`, but reads `GamepadState::axes` of every connected gamepad,
+    // so axis indices correspond to `GamepadAxis`
+    void processGamepads(std::span<float> output) {
+        for (int jid = 0; jid < kMaxJoysticks; ++jid) {
+            Joystick joystick{jid};
+            Gamepad gamepad = joystick.isPresent() ? joystick.gamepad() : Gamepad{};
+            if (!gamepad) {
+                clearSlot(jid);
+                continue;
+            }
+            resolveIfChanged(jid, joystick.guid());
+            GamepadState state = gamepad.state();
+            loadSlot(jid, state.axes);
+        }
+        run(output);
+    }
+};
+
+// Dense numbering of keys, mouse buttons, gamepad buttons and gamepad axis
+// directions, used to index flat binding tables
+GLFW_HPP_EXPORT class InputIndex {
+public:
+    static constexpr int kKeyCount = GLFW_KEY_LAST + 1;
+    static constexpr int kMouseButtonCount = GLFW_MOUSE_BUTTON_LAST + 1;
+    static constexpr int kGamepadButtonCount = GLFW_GAMEPAD_BUTTON_LAST + 1;
+    static constexpr int kGamepadAxisCount = (GLFW_GAMEPAD_AXIS_LAST + 1) * 2;
+
+    static constexpr int kMouseButtonBase = kKeyCount;
+    static constexpr int kGamepadButtonBase = kMouseButtonBase + kMouseButtonCount;
+    static constexpr int kGamepadAxisBase = kGamepadButtonBase + kGamepadButtonCount;
+    static constexpr int kCount = kGamepadAxisBase + kGamepadAxisCount;
+
+private:
+    int m_index = -1;
+
+public:
+    constexpr InputIndex() = default;
+
+    constexpr InputIndex(Key key) noexcept
+        : m_index(static_cast<int>(key) >= 0 && static_cast<int>(key) < kKeyCount ? static_cast<int>(key) : -1) {}
+
+    constexpr InputIndex(Button button) noexcept
+        : m_index(kMouseButtonBase + static_cast<int>(button)) {}
+
+    constexpr InputIndex(GamepadButton button) noexcept
+        : m_index(kGamepadButtonBase + static_cast<int>(button)) {}
+
+    // Each gamepad axis is split into a positive and a negative direction
+    constexpr InputIndex(GamepadAxis axis, bool negative = false) noexcept
+        : m_index(kGamepadAxisBase + static_cast<int>(axis) * 2 + (negative ? 1 : 0)) {}
+
+    GLFW_HPP_NODISCARD constexpr explicit operator bool() const noexcept {
+        return m_index >= 0 && m_index < kCount;
+    }
+
+    GLFW_HPP_NODISCARD constexpr bool operator==(InputIndex that) const noexcept {
+        return m_index == that.m_index;
+    }
+
+    GLFW_HPP_NODISCARD constexpr bool operator!=(InputIndex that) const noexcept {
+        return m_index != that.m_index;
+    }
+
+    GLFW_HPP_NODISCARD constexpr int value() const noexcept {
+        return m_index;
+    }
+};
+
+// Maps dense input indices to action IDs in a flat table.
+// `update()` walks the compiled list of bound inputs once per frame and produces
+// per-action state with edge flags. All storage is fixed-size, so rebinding never allocates.
+GLFW_HPP_EXPORT template <std::size_t MaxActions = 256>
+class ActionMap {
+public:
+    using ActionId = std::uint16_t;
+
+    static_assert(MaxActions < 0xFFFF, "ActionMap supports at most 65534 actions");
+
+    static constexpr ActionId kNoAction = 0xFFFF;
+
+    static constexpr std::uint8_t kDown = 1;
+    static constexpr std::uint8_t kPressed = 2;
+    static constexpr std::uint8_t kReleased = 4;
+
+private:
+    std::array<ActionId, InputIndex::kCount> m_table;
+    std::array<std::uint16_t, InputIndex::kCount> m_bound{};
+    std::size_t m_boundCount = 0;
+    bool m_dirty = false;
+    float m_axisThreshold = 0.5f;
+
+    std::array<std::uint8_t, MaxActions> m_states{};
+    std::array<float, MaxActions> m_values{};
+
+    void compile() noexcept {
+        m_boundCount = 0;
+        for (std::size_t i = 0; i < m_table.size(); ++i) {
+            if (m_table[i] != kNoAction) {
+                m_bound[m_boundCount++] = static_cast<std::uint16_t>(i);
+            }
+        }
+        m_dirty = false;
+    }
+
+public:
+    ActionMap() noexcept {
+        m_table.fill(kNoAction);
+    }
+
+    void bind(InputIndex input, ActionId action) noexcept {
+        if (input && action < MaxActions) {
+            m_table[input.value()] = action;
+            m_dirty = true;
+        }
+    }
+
+    void unbind(InputIndex input) noexcept {
+        if (input) {
+            m_table[input.value()] = kNoAction;
+            m_dirty = true;
+        }
+    }
+
+    void unbindAction(ActionId action) noexcept {
+        for (auto& bound : m_table) {
+            if (bound == action) {
+                bound = kNoAction;
+                m_dirty = true;
+            }
+        }
+    }
+
+    void clear() noexcept {
+        m_table.fill(kNoAction);
+        m_dirty = true;
+    }
+
+    GLFW_HPP_NODISCARD ActionId action(InputIndex input) const noexcept {
+        return input ? m_table[input.value()] : kNoAction;
+    }
+
+    // Gamepad axis directions count as down once deflected at least this far.
+    // Keys and buttons are down exactly when pressed.
+    void setAxisThreshold(float threshold) noexcept {
+        m_axisThreshold = threshold;
+    }
+
+    void update(Window window, Gamepad gamepad = {}) {
+        if (m_dirty) {
+            compile();
+        }
+
+        GamepadState state{};
+        if (gamepad) {
+            GLFW_HPP_PROFILE(GetGamepadState);
+            ::glfwGetGamepadState(gamepad.handle(), &state);
+        }
+
+        // Raw calls with a single checkError() below; the wrapper methods would check each one
+        std::array<std::uint8_t, MaxActions> down{};
+        m_values.fill(0.0f);
+        for (std::size_t i = 0; i < m_boundCount; ++i) {
+            int input = m_bound[i];
+            bool pressed;
+            float value;
+            if (input < InputIndex::kMouseButtonBase) {
+                GLFW_HPP_PROFILE(GetKey);
+                pressed = ::glfwGetKey(window.handle(), input) == GLFW_PRESS;
+                value = pressed ? 1.0f : 0.0f;
+            } else if (input < InputIndex::kGamepadButtonBase) {
+                GLFW_HPP_PROFILE(GetMouseButton);
+                pressed = ::glfwGetMouseButton(window.handle(), input - InputIndex::kMouseButtonBase) == GLFW_PRESS;
+                value = pressed ? 1.0f : 0.0f;
+            } else if (input < InputIndex::kGamepadAxisBase) {
+                pressed = state.buttons[input - InputIndex::kGamepadButtonBase] == GLFW_PRESS;
+                value = pressed ? 1.0f : 0.0f;
+            } else {
+                int axis = input - InputIndex::kGamepadAxisBase;
+                float raw = state.axes[axis / 2];
+                value = axis % 2 ? -raw : raw;
+                if (value < 0.0f) {
+                    value = 0.0f;
+                }
+                pressed = value > 0.0f && value >= m_axisThreshold;
+            }
+
+            ActionId action = m_table[input];
+            if (value > m_values[action]) {
+                m_values[action] = value;
+            }
+            if (pressed) {
+                down[action] = kDown;
+            }
+        }
+        checkError();
+
+        for (std::size_t action = 0; action < MaxActions; ++action) {
+            std::uint8_t was = m_states[action] & kDown;
+            std::uint8_t is = down[action];
+            m_states[action] = static_cast<std::uint8_t>(is | ((is & ~was) ? kPressed : 0) | ((was & ~is) ? kReleased : 0));
+        }
+    }
+
+    GLFW_HPP_NODISCARD std::span<const std::uint8_t> states() const noexcept {
+        return m_states;
+    }
+
+    GLFW_HPP_NODISCARD bool isDown(ActionId action) const noexcept {
+        return action < MaxActions && (m_states[action] & kDown);
+    }
+
+    GLFW_HPP_NODISCARD bool isPressed(ActionId action) const noexcept {
+        return action < MaxActions && (m_states[action] & kPressed);
+    }
+
+    GLFW_HPP_NODISCARD bool isReleased(ActionId action) const noexcept {
+        return action < MaxActions && (m_states[action] & kReleased);
+    }
+
+    // Largest value among the inputs bound to `action`: 1 for pressed buttons,
+    // the deflection for gamepad axis directions
+    GLFW_HPP_NODISCARD float value(ActionId action) const noexcept {
+        return action < MaxActions ? m_values[action] : 0.0f;
+    }
+};
+
+// Names of all keys for the current keyboard layout, kept in one arena so the views stay
+// valid until the next rebuild, plus dense lookups between keys and scancodes.
+// Call `refresh()` when a window gains focus; it samples a few layout-dependent keys and
+// rebuilds only if their names changed. Keys without a printable name map to an empty view.
+GLFW_HPP_EXPORT class KeyNameTable {
+private:
+    static constexpr int kKeyCount = GLFW_KEY_LAST + 1;
+    static constexpr std::array<Key, 8> kLayoutSamples = {
+        Key::eQ, Key::eW, Key::eA, Key::eZ, Key::eY, Key::eM, Key::eSemicolon, Key::eApostrophe,
+    };
+
+    std::string m_arena;
+    std::array<std::string_view, kKeyCount> m_names{};
+    std::array<int, kKeyCount> m_scancodes{};
+    std::vector<Key> m_keys;
+    std::uint64_t m_layout = 0;
+    bool m_built = false;
+
+    static std::uint64_t sampleLayout() {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (Key key : kLayoutSamples) {
+            for (char c : keyName(key)) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            }
+            hash = (hash ^ 0xFF) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+public:
+    KeyNameTable() = default;
+
+    KeyNameTable(const KeyNameTable&) = delete;
+    KeyNameTable& operator=(const KeyNameTable&) = delete;
+
+    // Builds the table on first use and rebuilds it if the layout changed since.
+    // Returns whether the table was (re)built.
+    bool refresh() {
+        std::uint64_t layout = sampleLayout();
+        if (m_built && layout == m_layout) {
+            return false;
+        }
+        rebuild();
+        m_layout = layout;
+        return true;
+    }
+
+    void rebuild() {
+        std::array<std::pair<std::size_t, std::size_t>, kKeyCount> ranges{};
+        m_arena.clear();
+        m_scancodes.fill(-1);
+        m_keys.clear();
+
+        for (int key = GLFW_KEY_SPACE; key < kKeyCount; ++key) {
+            int scancode = ::glfwGetKeyScancode(key);
+            if (scancode < 0) {
+                continue;
+            }
+            m_scancodes[key] = scancode;
+            if (static_cast<std::size_t>(scancode) >= m_keys.size()) {
+                m_keys.resize(static_cast<std::size_t>(scancode) + 1, Key::eUnknown);
+            }
+            m_keys[scancode] = static_cast<Key>(key);
+
+            const char* name = ::glfwGetKeyName(key, 0);
+            if (name != nullptr) {
+                ranges[key] = {m_arena.size(), std::strlen(name)};
+                m_arena.append(name);
+            }
+        }
+        checkError();
+
+        for (int key = 0; key < kKeyCount; ++key) {
+            m_names[key] = std::string_view{m_arena}.substr(ranges[key].first, ranges[key].second);
+        }
+        m_built = true;
+    }
+
+    GLFW_HPP_NODISCARD std::string_view name(Key key) const noexcept {
+        int index = static_cast<int>(key);
+        return index >= 0 && index < kKeyCount ? m_names[index] : std::string_view{};
+    }
+
+    GLFW_HPP_NODISCARD std::string_view nameByScancode(int scancode) const noexcept {
+        return name(key(scancode));
+    }
+
+    GLFW_HPP_NODISCARD int scancode(Key key) const noexcept {
+        int index = static_cast<int>(key);
+        return index >= 0 && index < kKeyCount ? m_scancodes[index] : -1;
+    }
+
+    GLFW_HPP_NODISCARD Key key(int scancode) const noexcept {
+        return scancode >= 0 && static_cast<std::size_t>(scancode) < m_keys.size() ? m_keys[scancode] : Key::eUnknown;
+    }
+};
+
+#if defined(_WIN32)
+#define GLFW_HPP_MAPPING_PLATFORM "Windows"
+#elif defined(__APPLE__)
+#define GLFW_HPP_MAPPING_PLATFORM "Mac OS X"
+#elif defined(__linux__)
+#define GLFW_HPP_MAPPING_PLATFORM "Linux"
+#endif
+
+// GUID-indexed view of an SDL gamepad mapping database.
+// Instead of handing the whole database to GLFW, only the mappings of joysticks
+// that are actually connected are submitted, in a single batch.
+// Call `submit()` from the joystick handler to cover joysticks connected later.
+// `toBinary()` saves the parsed index, mappings of other platforms already dropped, so
+// later runs can load it with `fromBinary()` without scanning the text again.
+GLFW_HPP_EXPORT class GamepadMappingDatabase {
+private:
+    struct Entry {
+        std::string_view guid;
+        std::string_view mapping;
+    };
+
+    // Binary layout: magic, entry count, then per entry the offset, length and GUID length
+    // of its mapping in the text that follows, all as native-endian uint32
+    static constexpr std::string_view kBinaryMagic = "GLFWMAP1";
+    static constexpr std::size_t kBinaryHeaderSize = 12;
+    static constexpr std::size_t kBinaryEntrySize = 12;
+
+    std::vector<char> m_storage;
+    // Sorted by GUID, one entry per GUID
+    std::vector<Entry> m_mappings;
+    std::unordered_set<std::string_view> m_submitted;
+    std::vector<std::string_view> m_pending;
+    std::string m_batch;
+
+    static bool isForThisPlatform(std::string_view mapping) noexcept {
+        auto field = mapping.find("platform:");
+        if (field == std::string_view::npos) {
+            return true;
+        }
+#ifdef GLFW_HPP_MAPPING_PLATFORM
+        std::string_view platform = mapping.substr(field + 9);
+        platform = platform.substr(0, platform.find(','));
+        return platform == GLFW_HPP_MAPPING_PLATFORM;
+#else
+        return true;
+#endif
+    }
+
+    static bool readFile(const std::string& path, std::vector<char>& storage) {
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        char chunk[16384];
+        std::size_t read;
+        while ((read = std::fread(chunk, 1, sizeof(chunk), file)) != 0) {
+            storage.insert(storage.end(), chunk, chunk + read);
+        }
+        std::fclose(file);
+        return true;
+    }
+
+    static std::uint32_t readUint32(const char* data) noexcept {
+        std::uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static void appendUint32(std::string& out, std::uint32_t value) {
+        char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        out.append(bytes, sizeof(bytes));
+    }
+
+    void index(std::string_view text) {
+        while (!text.empty()) {
+            auto end = text.find('\n');
+            std::string_view line = text.substr(0, end);
+            text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            if (line.empty() || line.front() == '#') {
+                continue;
+            }
+            auto comma = line.find(',');
+            if (comma == std::string_view::npos || !isForThisPlatform(line)) {
+                continue;
+            }
+            m_mappings.push_back({line.substr(0, comma), line});
+        }
+
+        // Later lines override earlier ones, as when GLFW parses the whole database
+        std::stable_sort(m_mappings.begin(), m_mappings.end(), [](const Entry& a, const Entry& b) {
+            return a.guid < b.guid;
+        });
+        auto out = m_mappings.begin();
+        for (auto it = m_mappings.begin(); it != m_mappings.end();) {
+            auto last = it;
+            while (++it != m_mappings.end() && it->guid == last->guid) {
+                last = it;
+            }
+            *out++ = *last;
+        }
+        m_mappings.erase(out, m_mappings.end());
+    }
+
+    // Validates offsets and ordering, so a truncated or foreign file is rejected
+    bool load(std::string_view data) {
+        if (data.size() < kBinaryHeaderSize || data.substr(0, kBinaryMagic.size()) != kBinaryMagic) {
+            return false;
+        }
+        std::size_t count = readUint32(data.data() + kBinaryMagic.size());
+        if ((data.size() - kBinaryHeaderSize) / kBinaryEntrySize < count) {
+            return false;
+        }
+        const char* table = data.data() + kBinaryHeaderSize;
+        std::string_view text = data.substr(kBinaryHeaderSize + count * kBinaryEntrySize);
+        m_mappings.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t offset = readUint32(table + i * kBinaryEntrySize);
+            std::size_t length = readUint32(table + i * kBinaryEntrySize + 4);
+            std::size_t guidLength = readUint32(table + i * kBinaryEntrySize + 8);
+            if (offset > text.size() || length > text.size() - offset || guidLength > length) {
+                m_mappings.clear();
+                return false;
+            }
+            std::string_view mapping = text.substr(offset, length);
+            Entry entry{mapping.substr(0, guidLength), mapping};
+            if (!m_mappings.empty() && !(m_mappings.back().guid < entry.guid)) {
+                m_mappings.clear();
+                return false;
+            }
+            m_mappings.push_back(entry);
+        }
+        return true;
+    }
+
+    const Entry* findEntry(std::string_view guid) const noexcept {
+        auto it = std::lower_bound(m_mappings.begin(), m_mappings.end(), guid, [](const Entry& entry, std::string_view key) {
+            return entry.guid < key;
+        });
+        return it != m_mappings.end() && it->guid == guid ? &*it : nullptr;
+    }
+
+    void enqueue(std::string_view guid) {
+        const Entry* entry = findEntry(guid);
+        if (entry == nullptr || m_submitted.count(entry->guid)
+            || std::find(m_pending.begin(), m_pending.end(), entry->guid) != m_pending.end()) {
+            return;
+        }
+        m_pending.push_back(entry->guid);
+        m_batch.append(entry->mapping);
+        m_batch.push_back('\n');
+    }
+
+    bool flush() {
+        if (m_batch.empty()) {
+            return true;
+        }
+        // GUIDs count as submitted only once GLFW accepted the batch, so a failed
+        // batch is retried by the next submit
+        bool success = false;
+        try {
+            success = updateGamepadMappings(m_batch.c_str());
+        } catch (...) {
+            m_batch.clear();
+            m_pending.clear();
+            throw;
+        }
+        if (success) {
+            m_submitted.insert(m_pending.begin(), m_pending.end());
+        }
+        m_batch.clear();
+        m_pending.clear();
+        return success;
+    }
+
+public:
+    GamepadMappingDatabase() = default;
+
+    // The index holds views into m_storage, whose buffer survives a move but not a copy
+    GamepadMappingDatabase(GamepadMappingDatabase&&) noexcept = default;
+    GamepadMappingDatabase& operator=(GamepadMappingDatabase&&) noexcept = default;
+    GamepadMappingDatabase(const GamepadMappingDatabase&) = delete;
+    GamepadMappingDatabase& operator=(const GamepadMappingDatabase&) = delete;
+
+    // Indexes `text` in place; it must outlive the database, e.g. a memory-mapped file
+    explicit GamepadMappingDatabase(std::string_view text) {
+        index(text);
+    }
+
+    GLFW_HPP_NODISCARD static std::optional<GamepadMappingDatabase> fromFile(const std::string& path) {
+        GamepadMappingDatabase database;
+        if (!readFile(path, database.m_storage)) {
+            return std::nullopt;
+        }
+        database.index({database.m_storage.data(), database.m_storage.size()});
+        return database;
+    }
+
+    // Loads the output of `toBinary()` in place; `data` must outlive the database, e.g. a
+    // memory-mapped file. Returns nothing if `data` is not a valid index.
+    GLFW_HPP_NODISCARD static std::optional<GamepadMappingDatabase> fromBinary(std::string_view data) {
+        GamepadMappingDatabase database;
+        if (!database.load(data)) {
+            return std::nullopt;
+        }
+        return database;
+    }
+
+    GLFW_HPP_NODISCARD static std::optional<GamepadMappingDatabase> fromBinaryFile(const std::string& path) {
+        GamepadMappingDatabase database;
+        if (!readFile(path, database.m_storage) || !database.load({database.m_storage.data(), database.m_storage.size()})) {
+            return std::nullopt;
+        }
+        return database;
+    }
+
+    // Native byte order: meant as a cache on the machine that wrote it
+    GLFW_HPP_NODISCARD std::string toBinary() const {
+        std::string out{kBinaryMagic};
+        appendUint32(out, static_cast<std::uint32_t>(m_mappings.size()));
+        std::uint32_t offset = 0;
+        for (const Entry& entry : m_mappings) {
+            appendUint32(out, offset);
+            appendUint32(out, static_cast<std::uint32_t>(entry.mapping.size()));
+            appendUint32(out, static_cast<std::uint32_t>(entry.guid.size()));
+            offset += static_cast<std::uint32_t>(entry.mapping.size() + 1);
+        }
+        for (const Entry& entry : m_mappings) {
+            out.append(entry.mapping);
+            out.push_back('\n');
+        }
+        return out;
+    }
+
+    GLFW_HPP_NODISCARD std::size_t size() const noexcept {
+        return m_mappings.size();
+    }
+
+    GLFW_HPP_NODISCARD std::optional<std::string_view> find(std::string_view guid) const {
+        if (const Entry* entry = findEntry(guid)) {
+            return entry->mapping;
+        }
+        return std::nullopt;
+    }
+
+    // Submits the mapping for `joystick`, unless it was already submitted
+    bool submit(Joystick joystick) {
+        if (joystick.isPresent()) {
+            enqueue(joystick.guid());
+        }
+        return flush();
+    }
+
+    // Submits the mappings for all connected joysticks in one call to GLFW
+    bool submitConnected() {
+        for (int jid = GLFW_JOYSTICK_1; jid <= GLFW_JOYSTICK_LAST; ++jid) {
+            Joystick joystick{jid};
+            if (joystick.isPresent()) {
+                enqueue(joystick.guid());
+            }
+        }
+        return flush();
+    }
+};
+
+#undef GLFW_HPP_MAPPING_PLATFORM
+
+GLFW_HPP_EXPORT struct KeyChord {
+    Key key = Key::eUnknown;
+    Mods mods{};
+};
+
+// Matches key chord sequences such as Ctrl+K Ctrl+C against registered shortcuts.
+// Bindings form a trie whose edges live in one hash table, so every key event is a
+// single lookup. A partially typed sequence is dropped after the chord timeout.
+GLFW_HPP_EXPORT class ShortcutMatcher {
+public:
+    using CommandId = std::uint32_t;
+
+    // Bindings registered for this mode are active in every mode
+    static constexpr int kAnyMode = -1;
+
+private:
+    static constexpr std::uint32_t kNoNode = 0xFFFFFFFF;
+    static constexpr unsigned kChordMods = GLFW_MOD_SHIFT | GLFW_MOD_CONTROL | GLFW_MOD_ALT | GLFW_MOD_SUPER;
+
+    struct Node {
+        std::optional<CommandId> command;
+        std::uint32_t parent = kNoNode;
+        std::uint32_t children = 0;
+        std::uint64_t edge = 0;
+    };
+
+    std::vector<Node> m_nodes;
+    std::vector<std::uint32_t> m_freeNodes;
+    std::unordered_map<std::uint64_t, std::uint32_t> m_edges;
+    std::unordered_map<int, std::uint32_t> m_roots;
+
+    int m_mode = 0;
+    std::uint32_t m_pending = kNoNode;
+    std::uint64_t m_lastPress = 0;
+    std::uint64_t m_timerFrequency = 0;
+    double m_timeout = 1.0;
+
+    static std::uint64_t edgeKey(std::uint32_t node, KeyChord chord) noexcept {
+        auto key = static_cast<std::uint64_t>(static_cast<std::uint16_t>(chord.key));
+        auto mods = static_cast<std::uint64_t>(static_cast<unsigned>(chord.mods) & kChordMods);
+        return (static_cast<std::uint64_t>(node) << 32) | (key << 8) | mods;
+    }
+
+    static bool isModifierKey(Key key) noexcept {
+        int value = static_cast<int>(key);
+        return value >= GLFW_KEY_LEFT_SHIFT && value <= GLFW_KEY_RIGHT_SUPER;
+    }
+
+    std::uint32_t allocateNode() {
+        if (!m_freeNodes.empty()) {
+            std::uint32_t node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            m_nodes[node] = Node{};
+            return node;
+        }
+        m_nodes.emplace_back();
+        return static_cast<std::uint32_t>(m_nodes.size() - 1);
+    }
+
+    std::uint32_t root(int mode) {
+        auto it = m_roots.find(mode);
+        if (it != m_roots.end()) {
+            return it->second;
+        }
+        std::uint32_t node = allocateNode();
+        m_roots.emplace(mode, node);
+        return node;
+    }
+
+    std::uint32_t findRoot(int mode) const noexcept {
+        auto it = m_roots.find(mode);
+        return it != m_roots.end() ? it->second : kNoNode;
+    }
+
+    std::uint32_t child(std::uint32_t node, KeyChord chord) const noexcept {
+        if (node == kNoNode) {
+            return kNoNode;
+        }
+        auto it = m_edges.find(edgeKey(node, chord));
+        return it != m_edges.end() ? it->second : kNoNode;
+    }
+
+    std::uint32_t find(std::span<const KeyChord> sequence, int mode) const noexcept {
+        std::uint32_t node = findRoot(mode);
+        for (const auto& chord : sequence) {
+            node = child(node, chord);
+        }
+        return node;
+    }
+
+    std::optional<CommandId> advance(std::uint32_t node) {
+        if (m_nodes[node].children == 0) {
+            m_pending = kNoNode;
+            return m_nodes[node].command;
+        }
+        m_pending = node;
+        return std::nullopt;
+    }
+
+public:
+    // Binds `sequence` to `command` in `mode`. Fails if the sequence is empty,
+    // already bound, or is a prefix of another binding or vice versa.
+    bool add(std::span<const KeyChord> sequence, CommandId command, int mode = 0) {
+        if (sequence.empty()) {
+            return false;
+        }
+        std::uint32_t node = root(mode);
+        std::size_t depth = 0;
+        for (; depth < sequence.size(); ++depth) {
+            std::uint32_t next = child(node, sequence[depth]);
+            if (next == kNoNode) {
+                break;
+            }
+            if (m_nodes[next].command) {
+                return false;
+            }
+            node = next;
+        }
+        if (depth == sequence.size()) {
+            return false;
+        }
+        for (; depth < sequence.size(); ++depth) {
+            std::uint32_t next = allocateNode();
+            std::uint64_t edge = edgeKey(node, sequence[depth]);
+            m_nodes[next].parent = node;
+            m_nodes[next].edge = edge;
+            m_nodes[node].children += 1;
+            m_edges.emplace(edge, next);
+            node = next;
+        }
+        m_nodes[node].command = command;
+        return true;
+    }
+
+    bool add(std::initializer_list<KeyChord> sequence, CommandId command, int mode = 0) {
+        return add(std::span<const KeyChord>{sequence.begin(), sequence.size()}, command, mode);
+    }
+
+    bool remove(std::span<const KeyChord> sequence, int mode = 0) {
+        std::uint32_t node = sequence.empty() ? kNoNode : find(sequence, mode);
+        if (node == kNoNode || !m_nodes[node].command) {
+            return false;
+        }
+        m_nodes[node].command.reset();
+        while (m_nodes[node].parent != kNoNode && m_nodes[node].children == 0 && !m_nodes[node].command) {
+            std::uint32_t parent = m_nodes[node].parent;
+            m_edges.erase(m_nodes[node].edge);
+            m_nodes[parent].children -= 1;
+            m_freeNodes.push_back(node);
+            node = parent;
+        }
+        m_pending = kNoNode;
+        return true;
+    }
+
+    bool remove(std::initializer_list<KeyChord> sequence, int mode = 0) {
+        return remove(std::span<const KeyChord>{sequence.begin(), sequence.size()}, mode);
+    }
+
+    GLFW_HPP_NODISCARD std::optional<CommandId> lookup(std::span<const KeyChord> sequence, int mode = 0) const noexcept {
+        std::uint32_t node = sequence.empty() ? kNoNode : find(sequence, mode);
+        return node != kNoNode ? m_nodes[node].command : std::nullopt;
+    }
+
+    void setMode(int mode) noexcept {
+        m_mode = mode;
+        m_pending = kNoNode;
+    }
+
+    GLFW_HPP_NODISCARD int mode() const noexcept {
+        return m_mode;
+    }
+
+    void setChordTimeout(double seconds) noexcept {
+        m_timeout = seconds;
+    }
+
+    GLFW_HPP_NODISCARD bool isPending() const noexcept {
+        return m_pending != kNoNode;
+    }
+
+    void reset() noexcept {
+        m_pending = kNoNode;
+    }
+
+    // Feeds one event from the key handler and returns the command completed by it, if any.
+    // Only presses count: holding a key does not repeat a shortcut or extend a sequence.
+    std::optional<CommandId> feed(Key key, int, Action action, Mods mods) {
+        if (action != Action::ePress || key == Key::eUnknown || isModifierKey(key)) {
+            return std::nullopt;
+        }
+
+        std::uint64_t now = timerValue();
+        if (m_timerFrequency == 0) {
+            m_timerFrequency = timerFrequency();
+        }
+        if (m_pending != kNoNode && static_cast<double>(now - m_lastPress) > m_timeout * static_cast<double>(m_timerFrequency)) {
+            m_pending = kNoNode;
+        }
+        m_lastPress = now;
+
+        KeyChord chord{key, mods};
+        if (m_pending != kNoNode) {
+            std::uint32_t next = child(m_pending, chord);
+            m_pending = kNoNode;
+            if (next != kNoNode) {
+                return advance(next);
+            }
+        }
+        std::uint32_t next = child(findRoot(m_mode), chord);
+        if (next == kNoNode && m_mode != kAnyMode) {
+            next = child(findRoot(kAnyMode), chord);
+        }
+        return next != kNoNode ? advance(next) : std::nullopt;
+    }
+};
+}
+
+#endif // GLFW_HPP_INPUT_INCLUDED
@@ -0,0 +1,532 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Per-function call counters and the trace recorder behind GLFW_HPP_ENABLE_PROFILING and
+// GLFW_HPP_ENABLE_TRACING. Included by glfw.hpp; declares nothing unless profiling is enabled.
+
+#ifndef GLFW_HPP_PROFILING_INCLUDED
+#define GLFW_HPP_PROFILING_INCLUDED
+
+#include "./glfw_config.hpp"
+
+#ifdef GLFW_HPP_ENABLE_PROFILING
+
+#ifndef GLFW_HPP_MODULE
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#ifdef GLFW_HPP_ENABLE_TRACING
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#endif
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+// !begin_generated
+// !generate_profiled_functions
+GLFW_HPP_EXPORT enum class ProfiledFunction {
+    eInit,
+    eTerminate,
+    eInitHint,
+    eInitAllocator,
+    eInitVulkanLoader,
+    eGetVersion,
+    eGetVersionString,
+    eGetError,
+    eSetErrorCallback,
+    eGetPlatform,
+    ePlatformSupported,
+    eGetMonitors,
+    eGetPrimaryMonitor,
+    eGetMonitorPos,
+    eGetMonitorWorkarea,
+    eGetMonitorPhysicalSize,
+    eGetMonitorContentScale,
+    eGetMonitorName,
+    eSetMonitorUserPointer,
+    eGetMonitorUserPointer,
+    eSetMonitorCallback,
+    eGetVideoModes,
+    eGetVideoMode,
+    eSetGamma,
+    eGetGammaRamp,
+    eSetGammaRamp,
+    eDefaultWindowHints,
+    eWindowHint,
+    eWindowHintString,
+    eCreateWindow,
+    eDestroyWindow,
+    eWindowShouldClose,
+    eSetWindowShouldClose,
+    eGetWindowTitle,
+    eSetWindowTitle,
+    eSetWindowIcon,
+    eGetWindowPos,
+    eSetWindowPos,
+    eGetWindowSize,
+    eSetWindowSizeLimits,
+    eSetWindowAspectRatio,
+    eSetWindowSize,
+    eGetFramebufferSize,
+    eGetWindowFrameSize,
+    eGetWindowContentScale,
+    eGetWindowOpacity,
+    eSetWindowOpacity,
+    eIconifyWindow,
+    eRestoreWindow,
+    eMaximizeWindow,
+    eShowWindow,
+    eHideWindow,
+    eFocusWindow,
+    eRequestWindowAttention,
+    eGetWindowMonitor,
+    eSetWindowMonitor,
+    eGetWindowAttrib,
+    eSetWindowAttrib,
+    eSetWindowUserPointer,
+    eGetWindowUserPointer,
+    eSetWindowPosCallback,
+    eSetWindowSizeCallback,
+    eSetWindowCloseCallback,
+    eSetWindowRefreshCallback,
+    eSetWindowFocusCallback,
+    eSetWindowIconifyCallback,
+    eSetWindowMaximizeCallback,
+    eSetFramebufferSizeCallback,
+    eSetWindowContentScaleCallback,
+    ePollEvents,
+    eWaitEvents,
+    eWaitEventsTimeout,
+    ePostEmptyEvent,
+    eGetInputMode,
+    eSetInputMode,
+    eRawMouseMotionSupported,
+    eGetKeyName,
+    eGetKeyScancode,
+    eGetKey,
+    eGetMouseButton,
+    eGetCursorPos,
+    eSetCursorPos,
+    eCreateCursor,
+    eCreateStandardCursor,
+    eDestroyCursor,
+    eSetCursor,
+    eSetKeyCallback,
+    eSetCharCallback,
+    eSetCharModsCallback,
+    eSetMouseButtonCallback,
+    eSetCursorPosCallback,
+    eSetCursorEnterCallback,
+    eSetScrollCallback,
+    eSetDropCallback,
+    eJoystickPresent,
+    eGetJoystickAxes,
+    eGetJoystickButtons,
+    eGetJoystickHats,
+    eGetJoystickName,
+    eGetJoystickGUID,
+    eSetJoystickUserPointer,
+    eGetJoystickUserPointer,
+    eJoystickIsGamepad,
+    eSetJoystickCallback,
+    eUpdateGamepadMappings,
+    eGetGamepadName,
+    eGetGamepadState,
+    eSetClipboardString,
+    eGetClipboardString,
+    eGetTime,
+    eSetTime,
+    eGetTimerValue,
+    eGetTimerFrequency,
+    eMakeContextCurrent,
+    eGetCurrentContext,
+    eSwapBuffers,
+    eSwapInterval,
+    eExtensionSupported,
+    eGetProcAddress,
+    eVulkanSupported,
+    eGetRequiredInstanceExtensions,
+    eGetInstanceProcAddress,
+    eGetPhysicalDevicePresentationSupport,
+    eCreateWindowSurface,
+    eGetWGPUSurface,
+    eCount,
+};
+constexpr std::string_view profiledFunctionNames[] = {
+    "glfwInit",
+    "glfwTerminate",
+    "glfwInitHint",
+    "glfwInitAllocator",
+    "glfwInitVulkanLoader",
+    "glfwGetVersion",
+    "glfwGetVersionString",
+    "glfwGetError",
+    "glfwSetErrorCallback",
+    "glfwGetPlatform",
+    "glfwPlatformSupported",
+    "glfwGetMonitors",
+    "glfwGetPrimaryMonitor",
+    "glfwGetMonitorPos",
+    "glfwGetMonitorWorkarea",
+    "glfwGetMonitorPhysicalSize",
+    "glfwGetMonitorContentScale",
+    "glfwGetMonitorName",
+    "glfwSetMonitorUserPointer",
+    "glfwGetMonitorUserPointer",
+    "glfwSetMonitorCallback",
+    "glfwGetVideoModes",
+    "glfwGetVideoMode",
+    "glfwSetGamma",
+    "glfwGetGammaRamp",
+    "glfwSetGammaRamp",
+    "glfwDefaultWindowHints",
+    "glfwWindowHint",
+    "glfwWindowHintString",
+    "glfwCreateWindow",
+    "glfwDestroyWindow",
+    "glfwWindowShouldClose",
+    "glfwSetWindowShouldClose",
+    "glfwGetWindowTitle",
+    "glfwSetWindowTitle",
+    "glfwSetWindowIcon",
+    "glfwGetWindowPos",
+    "glfwSetWindowPos",
+    "glfwGetWindowSize",
+    "glfwSetWindowSizeLimits",
+    "glfwSetWindowAspectRatio",
+    "glfwSetWindowSize",
+    "glfwGetFramebufferSize",
+    "glfwGetWindowFrameSize",
+    "glfwGetWindowContentScale",
+    "glfwGetWindowOpacity",
+    "glfwSetWindowOpacity",
+    "glfwIconifyWindow",
+    "glfwRestoreWindow",
+    "glfwMaximizeWindow",
+    "glfwShowWindow",
+    "glfwHideWindow",
+    "glfwFocusWindow",
+    "glfwRequestWindowAttention",
+    "glfwGetWindowMonitor",
+    "glfwSetWindowMonitor",
+    "glfwGetWindowAttrib",
+    "glfwSetWindowAttrib",
+    "glfwSetWindowUserPointer",
+    "glfwGetWindowUserPointer",
+    "glfwSetWindowPosCallback",
+    "glfwSetWindowSizeCallback",
+    "glfwSetWindowCloseCallback",
+    "glfwSetWindowRefreshCallback",
+    "glfwSetWindowFocusCallback",
+    "glfwSetWindowIconifyCallback",
+    "glfwSetWindowMaximizeCallback",
+    "glfwSetFramebufferSizeCallback",
+    "glfwSetWindowContentScaleCallback",
+    "glfwPollEvents",
+    "glfwWaitEvents",
+    "glfwWaitEventsTimeout",
+    "glfwPostEmptyEvent",
+    "glfwGetInputMode",
+    "glfwSetInputMode",
+    "glfwRawMouseMotionSupported",
+    "glfwGetKeyName",
+    "glfwGetKeyScancode",
+    "glfwGetKey",
+    "glfwGetMouseButton",
+    "glfwGetCursorPos",
+    "glfwSetCursorPos",
+    "glfwCreateCursor",
+    "glfwCreateStandardCursor",
+    "glfwDestroyCursor",
+    "glfwSetCursor",
+    "glfwSetKeyCallback",
+    "glfwSetCharCallback",
+    "glfwSetCharModsCallback",
+    "glfwSetMouseButtonCallback",
+    "glfwSetCursorPosCallback",
+    "glfwSetCursorEnterCallback",
+    "glfwSetScrollCallback",
+    "glfwSetDropCallback",
+    "glfwJoystickPresent",
+    "glfwGetJoystickAxes",
+    "glfwGetJoystickButtons",
+    "glfwGetJoystickHats",
+    "glfwGetJoystickName",
+    "glfwGetJoystickGUID",
+    "glfwSetJoystickUserPointer",
+    "glfwGetJoystickUserPointer",
+    "glfwJoystickIsGamepad",
+    "glfwSetJoystickCallback",
+    "glfwUpdateGamepadMappings",
+    "glfwGetGamepadName",
+    "glfwGetGamepadState",
+    "glfwSetClipboardString",
+    "glfwGetClipboardString",
+    "glfwGetTime",
+    "glfwSetTime",
+    "glfwGetTimerValue",
+    "glfwGetTimerFrequency",
+    "glfwMakeContextCurrent",
+    "glfwGetCurrentContext",
+    "glfwSwapBuffers",
+    "glfwSwapInterval",
+    "glfwExtensionSupported",
+    "glfwGetProcAddress",
+    "glfwVulkanSupported",
+    "glfwGetRequiredInstanceExtensions",
+    "glfwGetInstanceProcAddress",
+    "glfwGetPhysicalDevicePresentationSupport",
+    "glfwCreateWindowSurface",
+    "glfwGetWGPUSurface",
+};
+// !end_generated
+
+GLFW_HPP_EXPORT struct ProfileEntry {
+    std::string_view function;
+    std::uint64_t calls = 0;
+    double seconds = 0.0;
+};
+
+struct ProfileCounter {
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> ticks{0};
+};
+
+inline ProfileCounter profileCounters[static_cast<std::size_t>(ProfiledFunction::eCount)];
+
+#ifdef GLFW_HPP_ENABLE_TRACING
+// Records GLFW calls and event dispatches as spans into per-thread buffers.
+// Each thread only appends to its own buffer, so recording takes no locks;
+// the registry mutex is taken once per thread and when writing the trace out.
+// Timestamps come from glfwGetTimerValue.
+// Buffers grow in chunks allocated by the recording thread as they fill. Recording never
+// throws, since it runs in scope destructors: an event that would need memory that cannot
+// be allocated is dropped and counted in `droppedEvents()`.
+GLFW_HPP_EXPORT class Tracer {
+private:
+    struct Event {
+        const char* name;
+        const char* category;
+        std::uint64_t start;
+        std::uint64_t end;
+    };
+
+    struct Buffer {
+        static constexpr std::size_t kChunkSize = 1 << 12;
+        static constexpr std::size_t kCapacity = 1 << 16;
+
+        // Only the owning thread adds chunks; readers see those below `count`
+        std::array<std::unique_ptr<Event[]>, kCapacity / kChunkSize> chunks;
+        std::atomic<std::size_t> count{0};
+        std::size_t thread = 0;
+
+        GLFW_HPP_NODISCARD const Event& operator[](std::size_t index) const noexcept {
+            return chunks[index / kChunkSize][index % kChunkSize];
+        }
+    };
+
+    static inline std::atomic<bool> s_recording{false};
+    static inline std::atomic<std::uint64_t> s_dropped{0};
+    static inline std::mutex s_mutex;
+    static inline std::vector<std::shared_ptr<Buffer>> s_buffers;
+
+    // Null if the thread could not be registered
+    static Buffer* threadBuffer() noexcept {
+        thread_local std::shared_ptr<Buffer> buffer = []() noexcept -> std::shared_ptr<Buffer> {
+            try {
+                auto created = std::make_shared<Buffer>();
+                std::lock_guard lock{s_mutex};
+                created->thread = s_buffers.size() + 1;
+                s_buffers.push_back(created);
+                return created;
+            } catch (...) {
+                return nullptr;
+            }
+        }();
+        return buffer.get();
+    }
+
+public:
+    static void start() noexcept {
+        s_recording.store(true, std::memory_order_relaxed);
+    }
+
+    static void stop() noexcept {
+        s_recording.store(false, std::memory_order_relaxed);
+    }
+
+    GLFW_HPP_NODISCARD static bool isRecording() noexcept {
+        return s_recording.load(std::memory_order_relaxed);
+    }
+
+    GLFW_HPP_NODISCARD static std::uint64_t droppedEvents() noexcept {
+        return s_dropped.load(std::memory_order_relaxed);
+    }
+
+    static void record(const char* name, const char* category, std::uint64_t start, std::uint64_t end) noexcept {
+        Buffer* buffer = threadBuffer();
+        std::size_t index = buffer != nullptr ? buffer->count.load(std::memory_order_relaxed) : Buffer::kCapacity;
+        if (index == Buffer::kCapacity) {
+            s_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto& chunk = buffer->chunks[index / Buffer::kChunkSize];
+        if (chunk == nullptr) {
+            chunk.reset(new (std::nothrow) Event[Buffer::kChunkSize]);
+            if (chunk == nullptr) {
+                s_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+        chunk[index % Buffer::kChunkSize] = {name, category, start, end};
+        buffer->count.store(index + 1, std::memory_order_release);
+    }
+
+    // Discards recorded events but keeps the chunks; no traced call may be in flight on another thread
+    static void clear() {
+        std::lock_guard lock{s_mutex};
+        for (auto& buffer : s_buffers) {
+            buffer->count.store(0, std::memory_order_release);
+        }
+        s_dropped.store(0, std::memory_order_relaxed);
+    }
+
+    // Writes all recorded events in Chrome Trace Event JSON format,
+    // viewable in chrome://tracing and Perfetto
+    static bool writeChromeTrace(const std::string& path) {
+        std::FILE* file = std::fopen(path.c_str(), "w");
+        if (file == nullptr) {
+            return false;
+        }
+        double toMicroseconds = 1e6 / static_cast<double>(::glfwGetTimerFrequency());
+        std::fputs("{\"traceEvents\":[", file);
+        bool first = true;
+        {
+            std::lock_guard lock{s_mutex};
+            for (auto& buffer : s_buffers) {
+                std::size_t count = buffer->count.load(std::memory_order_acquire);
+                for (std::size_t i = 0; i < count; ++i) {
+                    const Event& event = (*buffer)[i];
+                    std::fprintf(
+                        file,
+                        "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%zu}",
+                        first ? "" : ",",
+                        event.name,
+                        event.category,
+                        static_cast<double>(event.start) * toMicroseconds,
+                        static_cast<double>(event.end - event.start) * toMicroseconds,
+                        buffer->thread
+                    );
+                    first = false;
+                }
+            }
+        }
+        std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+        return std::fclose(file) == 0;
+    }
+};
+
+GLFW_HPP_EXPORT class TraceScope {
+private:
+    const char* m_name;
+    std::uint64_t m_start;
+
+public:
+    explicit TraceScope(const char* name) noexcept
+        : m_name(name), m_start(Tracer::isRecording() ? ::glfwGetTimerValue() : 0) {}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (m_start != 0 && Tracer::isRecording()) {
+            Tracer::record(m_name, "event", m_start, ::glfwGetTimerValue());
+        }
+    }
+};
+#endif
+
+GLFW_HPP_EXPORT class ProfileScope {
+private:
+    ProfiledFunction m_function;
+    std::uint64_t m_start;
+
+public:
+    explicit ProfileScope(ProfiledFunction function) noexcept
+        : m_function(function), m_start(::glfwGetTimerValue()) {}
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope() {
+        std::uint64_t end = ::glfwGetTimerValue();
+        auto& counter = profileCounters[static_cast<std::size_t>(m_function)];
+        counter.calls.fetch_add(1, std::memory_order_relaxed);
+        if (m_start != 0 && end >= m_start) {
+            counter.ticks.fetch_add(end - m_start, std::memory_order_relaxed);
+#ifdef GLFW_HPP_ENABLE_TRACING
+            if (Tracer::isRecording()) {
+                Tracer::record(profiledFunctionNames[static_cast<std::size_t>(m_function)].data(), "glfw", m_start, end);
+            }
+#endif
+        }
+    }
+};
+
+// Returns call counts and accumulated time for every GLFW function called so far
+GLFW_HPP_API_NODISCARD std::vector<ProfileEntry> profileStats() {
+    double frequency = static_cast<double>(::glfwGetTimerFrequency());
+    std::vector<ProfileEntry> entries;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(ProfiledFunction::eCount); ++i) {
+        std::uint64_t calls = profileCounters[i].calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        std::uint64_t ticks = profileCounters[i].ticks.load(std::memory_order_relaxed);
+        entries.push_back({
+            .function = profiledFunctionNames[i],
+            .calls = calls,
+            .seconds = frequency > 0.0 ? static_cast<double>(ticks) / frequency : 0.0,
+        });
+    }
+    return entries;
+}
+
+GLFW_HPP_API void resetProfileStats() {
+    for (auto& counter : profileCounters) {
+        counter.calls.store(0, std::memory_order_relaxed);
+        counter.ticks.store(0, std::memory_order_relaxed);
+    }
+}
+}
+
+#endif // GLFW_HPP_ENABLE_PROFILING
+
+#endif // GLFW_HPP_PROFILING_INCLUDED
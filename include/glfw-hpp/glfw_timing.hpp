@@ -0,0 +1,402 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Frame pacing and fixed-timestep loops driven by the GLFW timer.
+
+#ifndef GLFW_HPP_TIMING_INCLUDED
+#define GLFW_HPP_TIMING_INCLUDED
+
+#include "./glfw.hpp"
+
+#ifndef GLFW_HPP_MODULE
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+#endif
+
+namespace GLFW_HPP_NAMESPACE {
+GLFW_HPP_EXPORT struct FrameStats {
+    std::uint64_t frames = 0;
+    double meanFrameTime = 0.0;
+    double frameTimeStdDev = 0.0;
+    double minFrameTime = 0.0;
+    double maxFrameTime = 0.0;
+    double meanLateness = 0.0;
+};
+
+// Paces frames to a target rate without relying on vsync.
+// `wait()` sleeps in `waitEvents(timeout)`, so input still wakes the event loop,
+// and finishes with a short spin whose length is calibrated from observed wakeup latency.
+// A rate of 0 means unpaced: `wait()` only polls events and records the frame.
+// Negative and non-finite rates are treated as 0. All times in `FrameStats` are in seconds.
+GLFW_HPP_EXPORT class FramePacer {
+private:
+    std::uint64_t m_frequency = 0;
+    std::uint64_t m_interval = 0;
+    std::uint64_t m_deadline = 0;
+    std::uint64_t m_lastFrame = 0;
+    double m_targetFrameRate = 60.0;
+    double m_wakeupLatency = 0.0;
+
+    std::uint64_t m_frames = 0;
+    double m_mean = 0.0;
+    double m_m2 = 0.0;
+    double m_min = 0.0;
+    double m_max = 0.0;
+    double m_lateness = 0.0;
+
+    void record(double frameTime, double lateness) noexcept {
+        m_frames += 1;
+        double delta = frameTime - m_mean;
+        m_mean += delta / static_cast<double>(m_frames);
+        m_m2 += delta * (frameTime - m_mean);
+        m_min = m_frames == 1 || frameTime < m_min ? frameTime : m_min;
+        m_max = m_frames == 1 || frameTime > m_max ? frameTime : m_max;
+        m_lateness += (lateness - m_lateness) / static_cast<double>(m_frames);
+    }
+
+    static double validRate(double framesPerSecond) noexcept {
+        return framesPerSecond > 0.0 && std::isfinite(framesPerSecond) ? framesPerSecond : 0.0;
+    }
+
+public:
+    explicit FramePacer(double framesPerSecond = 60.0) noexcept : m_targetFrameRate(validRate(framesPerSecond)) {}
+
+    void setTargetFrameRate(double framesPerSecond) noexcept {
+        m_targetFrameRate = validRate(framesPerSecond);
+        m_interval = 0;
+    }
+
+    GLFW_HPP_NODISCARD double targetFrameRate() const noexcept {
+        return m_targetFrameRate;
+    }
+
+    // Blocks until the next frame is due, dispatching events while waiting
+    void wait() {
+        if (m_targetFrameRate == 0.0) {
+            if (m_frequency == 0) {
+                m_frequency = timerFrequency();
+                m_lastFrame = timerValue();
+            }
+            pollEvents();
+            std::uint64_t now = timerValue();
+            record(static_cast<double>(now - m_lastFrame) / static_cast<double>(m_frequency), 0.0);
+            m_lastFrame = now;
+            return;
+        }
+
+        if (m_interval == 0) {
+            m_frequency = timerFrequency();
+            // Clamped so tiny rates cannot overflow the conversion
+            m_interval = static_cast<std::uint64_t>(std::min(static_cast<double>(m_frequency) / m_targetFrameRate, 1e18));
+            m_wakeupLatency = static_cast<double>(m_frequency) / 1000.0;
+            m_lastFrame = timerValue();
+            m_deadline = m_lastFrame + m_interval;
+        }
+
+        std::uint64_t now = timerValue();
+        while (now < m_deadline) {
+            double margin = std::min(2.0 * m_wakeupLatency, static_cast<double>(m_interval) / 2.0);
+            double remaining = static_cast<double>(m_deadline - now);
+            if (remaining <= margin) {
+                break;
+            }
+            double timeout = remaining - margin;
+            waitEvents(timeout / static_cast<double>(m_frequency));
+            std::uint64_t woke = timerValue();
+            double slept = static_cast<double>(woke - now);
+            if (slept >= timeout) {
+                m_wakeupLatency += (slept - timeout - m_wakeupLatency) / 8.0;
+            }
+            now = woke;
+        }
+        while (now < m_deadline) {
+            now = ::glfwGetTimerValue();
+        }
+
+        double frequency = static_cast<double>(m_frequency);
+        record(static_cast<double>(now - m_lastFrame) / frequency, static_cast<double>(now - m_deadline) / frequency);
+        m_lastFrame = now;
+        m_deadline += m_interval;
+        if (m_deadline <= now) {
+            m_deadline = now + m_interval;
+        }
+    }
+
+    GLFW_HPP_NODISCARD FrameStats stats() const noexcept {
+        FrameStats stats;
+        stats.frames = m_frames;
+        stats.meanFrameTime = m_mean;
+        stats.frameTimeStdDev = m_frames > 1 ? std::sqrt(m_m2 / static_cast<double>(m_frames - 1)) : 0.0;
+        stats.minFrameTime = m_min;
+        stats.maxFrameTime = m_max;
+        stats.meanLateness = m_lateness;
+        return stats;
+    }
+
+    void resetStats() noexcept {
+        m_frames = 0;
+        m_mean = 0.0;
+        m_m2 = 0.0;
+        m_min = 0.0;
+        m_max = 0.0;
+        m_lateness = 0.0;
+    }
+};
+
+GLFW_HPP_EXPORT enum class InputEventType : std::uint8_t {
+    eKey,
+    eChar,
+    eMouseButton,
+    eCursorPos,
+    eScroll,
+};
+
+GLFW_HPP_EXPORT struct InputEvent {
+    InputEventType type = InputEventType::eKey;
+    std::uint64_t timestamp = 0;
+    ::GLFWwindow* window = nullptr;
+    Key key = Key::eUnknown;
+    int scancode = 0;
+    Button button = Button::e1;
+    Action action = Action::eRelease;
+    Mods mods{};
+    unsigned codepoint = 0;
+    double x = 0.0;
+    double y = 0.0;
+};
+
+// Drives a fixed-timestep simulation from the event loop.
+// Input events of attached windows are queued with their `timerValue()` and handed
+// to the tick they belong to. GLFW reports no event times, so events are stamped when
+// they are dispatched: call `pollEvents()` or `waitEvents*()` between `advance()` calls,
+// and poll more often than once per frame if events need finer slicing than that.
+// Events polled in one call land in the same tick, and anything polled since the last
+// `advance()` is delivered no later than its last tick.
+// Attaching chains to the window's existing input handlers and detaching restores them.
+// Destroying the loop leaves the chained handlers in place, forwarding to the previous
+// handlers only, so windows destroyed first need not be detached.
+GLFW_HPP_EXPORT class FixedTimestepLoop {
+private:
+    struct Attachment {
+        Window window;
+        std::function<void(Key, int, Action, Mods)> key;
+        std::function<void(unsigned, Mods)> charMods;
+        std::function<void(Button, Action, Mods)> mouseButton;
+        std::function<void(double, double)> cursorPos;
+        std::function<void(double, double)> scroll;
+    };
+
+    // Shared with the installed handlers, which stop queueing once it is null
+    std::shared_ptr<FixedTimestepLoop*> m_self;
+    std::vector<Attachment> m_attachments;
+    std::vector<InputEvent> m_events;
+    std::size_t m_capacity;
+    std::uint64_t m_droppedEvents = 0;
+
+    double m_tickRate;
+    int m_maxTicksPerFrame = 8;
+    std::uint64_t m_frequency = 0;
+    std::uint64_t m_tickDuration = 0;
+    std::uint64_t m_simulatedUntil = 0;
+    std::uint64_t m_ticks = 0;
+    double m_alpha = 0.0;
+
+    void push(InputEvent event) noexcept {
+        if (m_events.size() == m_capacity) {
+            m_droppedEvents += 1;
+            return;
+        }
+        event.timestamp = ::glfwGetTimerValue();
+        m_events.push_back(event);
+    }
+
+    static void push(const std::shared_ptr<FixedTimestepLoop*>& self, const InputEvent& event) noexcept {
+        if (*self != nullptr) {
+            (*self)->push(event);
+        }
+    }
+
+public:
+    // Throws GLFW_INVALID_VALUE unless `ticksPerSecond` is positive and finite
+    explicit FixedTimestepLoop(double ticksPerSecond = 60.0, std::size_t eventCapacity = 1024)
+        : m_self(std::make_shared<FixedTimestepLoop*>(this)), m_capacity(eventCapacity), m_tickRate(ticksPerSecond) {
+        if (!(ticksPerSecond > 0.0) || !std::isfinite(ticksPerSecond)) {
+            throw GLFWException{GLFW_INVALID_VALUE, "FixedTimestepLoop tick rate must be positive and finite"};
+        }
+        m_events.reserve(eventCapacity);
+    }
+
+    FixedTimestepLoop(const FixedTimestepLoop&) = delete;
+    FixedTimestepLoop& operator=(const FixedTimestepLoop&) = delete;
+
+    ~FixedTimestepLoop() {
+        *m_self = nullptr;
+    }
+
+    // Installs key, char, mouse button, cursor and scroll handlers on `window` that queue
+    // events for this loop and then call the handlers set before
+    void attach(Window window) {
+        auto found = std::find_if(m_attachments.begin(), m_attachments.end(), [window](const Attachment& attachment) {
+            return attachment.window == window;
+        });
+        if (found != m_attachments.end()) {
+            return;
+        }
+        Attachment attachment{
+            .window = window,
+            .key = window.getKeyHandler(),
+            .charMods = window.getCharModsHandler(),
+            .mouseButton = window.getMouseButtonHandler(),
+            .cursorPos = window.getCursorPosHandler(),
+            .scroll = window.getScrollHandler(),
+        };
+        ::GLFWwindow* handle = window.handle();
+        window.setKeyHandler([self = m_self, handle, next = attachment.key](Key key, int scancode, Action action, Mods mods) {
+            push(self, {.type = InputEventType::eKey, .window = handle, .key = key, .scancode = scancode, .action = action, .mods = mods});
+            if (next) {
+                next(key, scancode, action, mods);
+            }
+        });
+        window.setCharModsHandler([self = m_self, handle, next = attachment.charMods](unsigned codepoint, Mods mods) {
+            push(self, {.type = InputEventType::eChar, .window = handle, .mods = mods, .codepoint = codepoint});
+            if (next) {
+                next(codepoint, mods);
+            }
+        });
+        window.setMouseButtonHandler([self = m_self, handle, next = attachment.mouseButton](Button button, Action action, Mods mods) {
+            push(self, {.type = InputEventType::eMouseButton, .window = handle, .button = button, .action = action, .mods = mods});
+            if (next) {
+                next(button, action, mods);
+            }
+        });
+        window.setCursorPosHandler([self = m_self, handle, next = attachment.cursorPos](double x, double y) {
+            push(self, {.type = InputEventType::eCursorPos, .window = handle, .x = x, .y = y});
+            if (next) {
+                next(x, y);
+            }
+        });
+        window.setScrollHandler([self = m_self, handle, next = attachment.scroll](double x, double y) {
+            push(self, {.type = InputEventType::eScroll, .window = handle, .x = x, .y = y});
+            if (next) {
+                next(x, y);
+            }
+        });
+        m_attachments.push_back(std::move(attachment));
+    }
+
+    // Restores the handlers `window` had before `attach()`; the window must still exist
+    void detach(Window window) noexcept {
+        auto it = std::find_if(m_attachments.begin(), m_attachments.end(), [window](const Attachment& attachment) {
+            return attachment.window == window;
+        });
+        if (it == m_attachments.end()) {
+            return;
+        }
+        Attachment attachment = std::move(*it);
+        m_attachments.erase(it);
+        try {
+            window.setKeyHandler(std::move(attachment.key));
+            window.setCharModsHandler(std::move(attachment.charMods));
+            window.setMouseButtonHandler(std::move(attachment.mouseButton));
+            window.setCursorPosHandler(std::move(attachment.cursorPos));
+            window.setScrollHandler(std::move(attachment.scroll));
+        } catch (const GLFWException&) {
+            // GLFW was already terminated, taking the handlers with it
+        }
+    }
+
+    void detach() noexcept {
+        while (!m_attachments.empty()) {
+            detach(m_attachments.back().window);
+        }
+    }
+
+    // Upper bound on ticks per `advance()`; time beyond it is dropped instead of caught up
+    void setMaxTicksPerFrame(int ticks) noexcept {
+        m_maxTicksPerFrame = ticks > 0 ? ticks : 1;
+    }
+
+    // Runs every fixed tick that is due, calling `tick(std::span<const InputEvent>)` once
+    // per tick with the events queued up to its end. Returns the number of ticks run.
+    // Does not poll; see the class comment.
+    template <typename TickFn>
+    int advance(TickFn&& tick) {
+        if (m_tickDuration == 0) {
+            m_frequency = timerFrequency();
+            m_tickDuration = static_cast<std::uint64_t>(static_cast<double>(m_frequency) / m_tickRate);
+            m_simulatedUntil = timerValue();
+        }
+
+        std::uint64_t now = timerValue();
+
+        std::uint64_t due = (now - m_simulatedUntil) / m_tickDuration;
+        if (due > static_cast<std::uint64_t>(m_maxTicksPerFrame)) {
+            m_simulatedUntil += (due - m_maxTicksPerFrame) * m_tickDuration;
+            due = m_maxTicksPerFrame;
+        }
+
+        std::size_t begin = 0;
+        for (std::uint64_t i = 0; i < due; ++i) {
+            std::uint64_t tickEnd = m_simulatedUntil + m_tickDuration;
+            std::uint64_t sliceEnd = i + 1 == due ? now + 1 : tickEnd;
+            std::size_t end = begin;
+            while (end < m_events.size() && m_events[end].timestamp < sliceEnd) {
+                ++end;
+            }
+            tick(std::span<const InputEvent>{m_events.data() + begin, end - begin});
+            begin = end;
+            m_simulatedUntil = tickEnd;
+            m_ticks += 1;
+        }
+        m_events.erase(m_events.begin(), m_events.begin() + static_cast<std::ptrdiff_t>(begin));
+
+        m_alpha = static_cast<double>(now - m_simulatedUntil) / static_cast<double>(m_tickDuration);
+        return static_cast<int>(due);
+    }
+
+    // Fraction of a tick between the last simulated state and now, for interpolation
+    GLFW_HPP_NODISCARD double alpha() const noexcept {
+        return m_alpha;
+    }
+
+    GLFW_HPP_NODISCARD double tickDuration() const noexcept {
+        return 1.0 / m_tickRate;
+    }
+
+    GLFW_HPP_NODISCARD std::uint64_t ticks() const noexcept {
+        return m_ticks;
+    }
+
+    GLFW_HPP_NODISCARD std::uint64_t droppedEvents() const noexcept {
+        return m_droppedEvents;
+    }
+};
+}
+
+#endif // GLFW_HPP_TIMING_INCLUDED
@@ -0,0 +1,1189 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#if __has_include("vulkan/vulkan.h")
+#include "vulkan/vulkan.h"
+#endif
+
+#include "./glfw_mock.hpp"
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+
+namespace glfw_mock {
+namespace {
+struct Storage {
+    State state;
+    GlobalCallbacks globalCallbacks;
+    std::unordered_map<GLFWwindow*, WindowCallbacks> windowCallbacks;
+    std::unordered_map<const void*, void*> userPointers;
+    std::array<void*, GLFW_JOYSTICK_LAST + 1> joystickUserPointers{};
+    std::uintptr_t nextHandle = 0x1000;
+    std::uint64_t timer = 0;
+};
+
+Storage& storage() {
+    static Storage instance;
+    return instance;
+}
+
+// GLFW keeps the last error per thread
+struct ErrorState {
+    int code = GLFW_NO_ERROR;
+    const char* description = nullptr;
+};
+
+ErrorState& errorState() {
+    thread_local ErrorState error;
+    return error;
+}
+
+void raise(int code) {
+    if (code != GLFW_NO_ERROR) {
+        injectError(code);
+    }
+}
+
+// Distinct fake handles for created objects; the wrapper never dereferences them
+template <typename T>
+T* makeHandle() {
+    storage().nextHandle += 16;
+    return reinterpret_cast<T*>(storage().nextHandle);
+}
+
+constexpr std::uint64_t kTimerFrequency = 1000000000;
+
+// Advances by one microsecond per call, so code waiting on the timer makes progress
+std::uint64_t advanceTimer() {
+    storage().timer += kTimerFrequency / 1000000;
+    return storage().timer;
+}
+
+GLFWmonitor* primaryMonitor() {
+    static char monitor;
+    return reinterpret_cast<GLFWmonitor*>(&monitor);
+}
+
+void*& joystickUserPointer(int jid) {
+    static void* invalid = nullptr;
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST) {
+        invalid = nullptr;
+        return invalid;
+    }
+    return storage().joystickUserPointers[jid];
+}
+}
+
+std::recursive_mutex& mutex() {
+    static std::recursive_mutex instance;
+    return instance;
+}
+
+State& state() {
+    return storage().state;
+}
+
+WindowCallbacks& windowCallbacks(GLFWwindow* window) {
+    return storage().windowCallbacks[window];
+}
+
+GlobalCallbacks& globalCallbacks() {
+    return storage().globalCallbacks;
+}
+
+void injectError(int code, const char* description) {
+    std::lock_guard lock{mutex()};
+    errorState() = {code, description};
+    if (storage().globalCallbacks.error != nullptr) {
+        storage().globalCallbacks.error(code, description);
+    }
+}
+
+void reset() {
+    std::lock_guard lock{mutex()};
+    storage() = Storage{};
+    errorState() = {};
+}
+}
+
+int glfwGetError(const char** description) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getError;
+    stub.calls += 1;
+    auto error = std::exchange(glfw_mock::errorState(), {});
+    int code = error.code;
+    const char* message = error.description;
+    if (description != nullptr) {
+        *description = code != GLFW_NO_ERROR ? message : nullptr;
+    }
+    return code;
+}
+
+// !begin_generated
+// !generate_mock_definitions
+int glfwInit() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().init;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : GLFW_TRUE;
+}
+
+void glfwTerminate() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().terminate;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwInitHint(int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().initHint;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwInitAllocator(const GLFWallocator*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().initAllocator;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+#ifdef VK_VERSION_1_0
+void glfwInitVulkanLoader(PFN_vkGetInstanceProcAddr) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().initVulkanLoader;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+#endif
+
+void glfwGetVersion(int* major, int* minor, int* rev) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getVersion;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (major != nullptr) {
+        *major = stub.major;
+    }
+    if (minor != nullptr) {
+        *minor = stub.minor;
+    }
+    if (rev != nullptr) {
+        *rev = stub.rev;
+    }
+}
+
+const char* glfwGetVersionString() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getVersionString;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "3.4.0 mock";
+}
+
+GLFWerrorfun glfwSetErrorCallback(GLFWerrorfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setErrorCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::globalCallbacks().error, callback);
+}
+
+int glfwGetPlatform() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getPlatform;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : GLFW_PLATFORM_NULL;
+}
+
+int glfwPlatformSupported(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().platformSupported;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : GLFW_TRUE;
+}
+
+GLFWmonitor** glfwGetMonitors(int* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitors;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+GLFWmonitor* glfwGetPrimaryMonitor() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getPrimaryMonitor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::primaryMonitor();
+}
+
+void glfwGetMonitorPos(GLFWmonitor*, int* xpos, int* ypos) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorPos;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xpos != nullptr) {
+        *xpos = stub.xpos;
+    }
+    if (ypos != nullptr) {
+        *ypos = stub.ypos;
+    }
+}
+
+void glfwGetMonitorWorkarea(GLFWmonitor*, int* xpos, int* ypos, int* width, int* height) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorWorkarea;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xpos != nullptr) {
+        *xpos = stub.xpos;
+    }
+    if (ypos != nullptr) {
+        *ypos = stub.ypos;
+    }
+    if (width != nullptr) {
+        *width = stub.width;
+    }
+    if (height != nullptr) {
+        *height = stub.height;
+    }
+}
+
+void glfwGetMonitorPhysicalSize(GLFWmonitor*, int* widthMM, int* heightMM) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorPhysicalSize;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (widthMM != nullptr) {
+        *widthMM = stub.widthMM;
+    }
+    if (heightMM != nullptr) {
+        *heightMM = stub.heightMM;
+    }
+}
+
+void glfwGetMonitorContentScale(GLFWmonitor*, float* xscale, float* yscale) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorContentScale;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xscale != nullptr) {
+        *xscale = stub.xscale;
+    }
+    if (yscale != nullptr) {
+        *yscale = stub.yscale;
+    }
+}
+
+const char* glfwGetMonitorName(GLFWmonitor*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorName;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+void glfwSetMonitorUserPointer(GLFWmonitor* monitor, void* pointer) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setMonitorUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    glfw_mock::storage().userPointers[monitor] = pointer;
+}
+
+void* glfwGetMonitorUserPointer(GLFWmonitor* monitor) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMonitorUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return glfw_mock::storage().userPointers[monitor];
+}
+
+GLFWmonitorfun glfwSetMonitorCallback(GLFWmonitorfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setMonitorCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::globalCallbacks().monitor, callback);
+}
+
+const GLFWvidmode* glfwGetVideoModes(GLFWmonitor*, int* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getVideoModes;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+const GLFWvidmode* glfwGetVideoMode(GLFWmonitor*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getVideoMode;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+void glfwSetGamma(GLFWmonitor*, float) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setGamma;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getGammaRamp;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+void glfwSetGammaRamp(GLFWmonitor*, const GLFWgammaramp*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setGammaRamp;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwDefaultWindowHints() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().defaultWindowHints;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwWindowHint(int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().windowHint;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwWindowHintString(int, const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().windowHintString;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+GLFWwindow* glfwCreateWindow(int, int, const char*, GLFWmonitor*, GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().createWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::makeHandle<GLFWwindow>();
+}
+
+void glfwDestroyWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().destroyWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+int glfwWindowShouldClose(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().windowShouldClose;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+void glfwSetWindowShouldClose(GLFWwindow*, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowShouldClose;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+const char* glfwGetWindowTitle(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowTitle;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+void glfwSetWindowTitle(GLFWwindow*, const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowTitle;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSetWindowIcon(GLFWwindow*, int, const GLFWimage*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowIcon;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwGetWindowPos(GLFWwindow*, int* xpos, int* ypos) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowPos;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xpos != nullptr) {
+        *xpos = stub.xpos;
+    }
+    if (ypos != nullptr) {
+        *ypos = stub.ypos;
+    }
+}
+
+void glfwSetWindowPos(GLFWwindow*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowPos;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwGetWindowSize(GLFWwindow*, int* width, int* height) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowSize;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (width != nullptr) {
+        *width = stub.width;
+    }
+    if (height != nullptr) {
+        *height = stub.height;
+    }
+}
+
+void glfwSetWindowSizeLimits(GLFWwindow*, int, int, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowSizeLimits;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSetWindowAspectRatio(GLFWwindow*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowAspectRatio;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSetWindowSize(GLFWwindow*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowSize;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwGetFramebufferSize(GLFWwindow*, int* width, int* height) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getFramebufferSize;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (width != nullptr) {
+        *width = stub.width;
+    }
+    if (height != nullptr) {
+        *height = stub.height;
+    }
+}
+
+void glfwGetWindowFrameSize(GLFWwindow*, int* left, int* top, int* right, int* bottom) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowFrameSize;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (left != nullptr) {
+        *left = stub.left;
+    }
+    if (top != nullptr) {
+        *top = stub.top;
+    }
+    if (right != nullptr) {
+        *right = stub.right;
+    }
+    if (bottom != nullptr) {
+        *bottom = stub.bottom;
+    }
+}
+
+void glfwGetWindowContentScale(GLFWwindow*, float* xscale, float* yscale) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowContentScale;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xscale != nullptr) {
+        *xscale = stub.xscale;
+    }
+    if (yscale != nullptr) {
+        *yscale = stub.yscale;
+    }
+}
+
+float glfwGetWindowOpacity(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowOpacity;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : float{};
+}
+
+void glfwSetWindowOpacity(GLFWwindow*, float) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowOpacity;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwIconifyWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().iconifyWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwRestoreWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().restoreWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwMaximizeWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().maximizeWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwShowWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().showWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwHideWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().hideWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwFocusWindow(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().focusWindow;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwRequestWindowAttention(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().requestWindowAttention;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+GLFWmonitor* glfwGetWindowMonitor(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowMonitor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+void glfwSetWindowMonitor(GLFWwindow*, GLFWmonitor*, int, int, int, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowMonitor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+int glfwGetWindowAttrib(GLFWwindow*, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowAttrib;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+void glfwSetWindowAttrib(GLFWwindow*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowAttrib;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSetWindowUserPointer(GLFWwindow* window, void* pointer) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    glfw_mock::storage().userPointers[window] = pointer;
+}
+
+void* glfwGetWindowUserPointer(GLFWwindow* window) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getWindowUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return glfw_mock::storage().userPointers[window];
+}
+
+GLFWwindowposfun glfwSetWindowPosCallback(GLFWwindow* window, GLFWwindowposfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowPosCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowPos, callback);
+}
+
+GLFWwindowsizefun glfwSetWindowSizeCallback(GLFWwindow* window, GLFWwindowsizefun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowSizeCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowSize, callback);
+}
+
+GLFWwindowclosefun glfwSetWindowCloseCallback(GLFWwindow* window, GLFWwindowclosefun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowCloseCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowClose, callback);
+}
+
+GLFWwindowrefreshfun glfwSetWindowRefreshCallback(GLFWwindow* window, GLFWwindowrefreshfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowRefreshCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowRefresh, callback);
+}
+
+GLFWwindowfocusfun glfwSetWindowFocusCallback(GLFWwindow* window, GLFWwindowfocusfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowFocusCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowFocus, callback);
+}
+
+GLFWwindowiconifyfun glfwSetWindowIconifyCallback(GLFWwindow* window, GLFWwindowiconifyfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowIconifyCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowIconify, callback);
+}
+
+GLFWwindowmaximizefun glfwSetWindowMaximizeCallback(GLFWwindow* window, GLFWwindowmaximizefun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowMaximizeCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowMaximize, callback);
+}
+
+GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow* window, GLFWframebuffersizefun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setFramebufferSizeCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).framebufferSize, callback);
+}
+
+GLFWwindowcontentscalefun glfwSetWindowContentScaleCallback(GLFWwindow* window, GLFWwindowcontentscalefun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setWindowContentScaleCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).windowContentScale, callback);
+}
+
+void glfwPollEvents() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().pollEvents;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwWaitEvents() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().waitEvents;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwWaitEventsTimeout(double) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().waitEventsTimeout;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwPostEmptyEvent() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().postEmptyEvent;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+int glfwGetInputMode(GLFWwindow*, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getInputMode;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+void glfwSetInputMode(GLFWwindow*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setInputMode;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+int glfwRawMouseMotionSupported() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().rawMouseMotionSupported;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+const char* glfwGetKeyName(int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getKeyName;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+int glfwGetKeyScancode(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getKeyScancode;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+int glfwGetKey(GLFWwindow*, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getKey;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+int glfwGetMouseButton(GLFWwindow*, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getMouseButton;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+void glfwGetCursorPos(GLFWwindow*, double* xpos, double* ypos) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getCursorPos;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (xpos != nullptr) {
+        *xpos = stub.xpos;
+    }
+    if (ypos != nullptr) {
+        *ypos = stub.ypos;
+    }
+}
+
+void glfwSetCursorPos(GLFWwindow*, double, double) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCursorPos;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+GLFWcursor* glfwCreateCursor(const GLFWimage*, int, int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().createCursor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::makeHandle<GLFWcursor>();
+}
+
+GLFWcursor* glfwCreateStandardCursor(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().createStandardCursor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::makeHandle<GLFWcursor>();
+}
+
+void glfwDestroyCursor(GLFWcursor*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().destroyCursor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSetCursor(GLFWwindow*, GLFWcursor*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCursor;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+GLFWkeyfun glfwSetKeyCallback(GLFWwindow* window, GLFWkeyfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setKeyCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).key, callback);
+}
+
+GLFWcharfun glfwSetCharCallback(GLFWwindow* window, GLFWcharfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCharCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).character, callback);
+}
+
+GLFWcharmodsfun glfwSetCharModsCallback(GLFWwindow* window, GLFWcharmodsfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCharModsCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).charMods, callback);
+}
+
+GLFWmousebuttonfun glfwSetMouseButtonCallback(GLFWwindow* window, GLFWmousebuttonfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setMouseButtonCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).mouseButton, callback);
+}
+
+GLFWcursorposfun glfwSetCursorPosCallback(GLFWwindow* window, GLFWcursorposfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCursorPosCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).cursorPos, callback);
+}
+
+GLFWcursorenterfun glfwSetCursorEnterCallback(GLFWwindow* window, GLFWcursorenterfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setCursorEnterCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).cursorEnter, callback);
+}
+
+GLFWscrollfun glfwSetScrollCallback(GLFWwindow* window, GLFWscrollfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setScrollCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).scroll, callback);
+}
+
+GLFWdropfun glfwSetDropCallback(GLFWwindow* window, GLFWdropfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setDropCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::windowCallbacks(window).drop, callback);
+}
+
+int glfwJoystickPresent(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().joystickPresent;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+const float* glfwGetJoystickAxes(int, int* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickAxes;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+const unsigned char* glfwGetJoystickButtons(int, int* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickButtons;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+const unsigned char* glfwGetJoystickHats(int, int* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickHats;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+const char* glfwGetJoystickName(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickName;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+const char* glfwGetJoystickGUID(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickGUID;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+void glfwSetJoystickUserPointer(int jid, void* pointer) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setJoystickUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    glfw_mock::joystickUserPointer(jid) = pointer;
+}
+
+void* glfwGetJoystickUserPointer(int jid) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getJoystickUserPointer;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return glfw_mock::joystickUserPointer(jid);
+}
+
+int glfwJoystickIsGamepad(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().joystickIsGamepad;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun callback) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setJoystickCallback;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return std::exchange(glfw_mock::globalCallbacks().joystick, callback);
+}
+
+int glfwUpdateGamepadMappings(const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().updateGamepadMappings;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+const char* glfwGetGamepadName(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getGamepadName;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+int glfwGetGamepadState(int, GLFWgamepadstate* state) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getGamepadState;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (state != nullptr) {
+        *state = stub.state;
+    }
+    return stub.returns ? *stub.returns : int{};
+}
+
+void glfwSetClipboardString(GLFWwindow*, const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setClipboardString;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+const char* glfwGetClipboardString(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getClipboardString;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : "";
+}
+
+double glfwGetTime() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getTime;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : double{};
+}
+
+void glfwSetTime(double) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().setTime;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+uint64_t glfwGetTimerValue() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getTimerValue;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::advanceTimer();
+}
+
+uint64_t glfwGetTimerFrequency() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getTimerFrequency;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : glfw_mock::kTimerFrequency;
+}
+
+void glfwMakeContextCurrent(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().makeContextCurrent;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+GLFWwindow* glfwGetCurrentContext() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getCurrentContext;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+void glfwSwapBuffers(GLFWwindow*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().swapBuffers;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+void glfwSwapInterval(int) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().swapInterval;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+}
+
+int glfwExtensionSupported(const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().extensionSupported;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+GLFWglproc glfwGetProcAddress(const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getProcAddress;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : GLFWglproc{};
+}
+
+int glfwVulkanSupported() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().vulkanSupported;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+
+const char** glfwGetRequiredInstanceExtensions(uint32_t* count) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getRequiredInstanceExtensions;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    if (count != nullptr) {
+        *count = stub.count;
+    }
+    return stub.returns ? *stub.returns : nullptr;
+}
+
+#ifdef VK_VERSION_1_0
+GLFWvkproc glfwGetInstanceProcAddress(VkInstance, const char*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getInstanceProcAddress;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : GLFWvkproc{};
+}
+#endif
+
+#ifdef VK_VERSION_1_0
+int glfwGetPhysicalDevicePresentationSupport(VkInstance, VkPhysicalDevice, uint32_t) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().getPhysicalDevicePresentationSupport;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : int{};
+}
+#endif
+
+#ifdef VK_VERSION_1_0
+VkResult glfwCreateWindowSurface(VkInstance, GLFWwindow*, const VkAllocationCallbacks*, VkSurfaceKHR*) {
+    std::lock_guard lock{glfw_mock::mutex()};
+    auto& stub = glfw_mock::state().createWindowSurface;
+    stub.calls += 1;
+    glfw_mock::raise(stub.error);
+    return stub.returns ? *stub.returns : VkResult{};
+}
+#endif
+
+// !end_generated
@@ -0,0 +1,932 @@
+/*
+Copyright (c) 2024 Nikita Tsarev
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Link-time replacement for GLFW, generated from api.yaml. Every GLFW function counts its
+// calls, returns a canned value and fills out parameters from the matching stub in
+// `state()`. A stub whose `error` is set raises that error on every call, reported by the
+// next `glfwGetError`. User pointers and callbacks are stored, so the C++ wrapper works
+// unchanged and tests can invoke the registered callbacks directly.
+// Calls are serialized by `mutex()`, so code under test may call GLFW from worker threads.
+
+#ifndef GLFW_HPP_MOCK_INCLUDED
+#define GLFW_HPP_MOCK_INCLUDED
+
+#include <GLFW/glfw3.h>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace glfw_mock {
+// !begin_generated
+// !generate_mock_declarations
+struct InitStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct TerminateStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct InitHintStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct InitAllocatorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+#ifdef VK_VERSION_1_0
+struct InitVulkanLoaderStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+#endif
+
+struct GetVersionStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int major{};
+    int minor{};
+    int rev{};
+};
+
+struct GetVersionStringStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct GetErrorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetErrorCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetPlatformStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct PlatformSupportedStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetMonitorsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int count{};
+    std::optional<GLFWmonitor**> returns;
+};
+
+struct GetPrimaryMonitorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWmonitor*> returns;
+};
+
+struct GetMonitorPosStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int xpos{};
+    int ypos{};
+};
+
+struct GetMonitorWorkareaStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int xpos{};
+    int ypos{};
+    int width{};
+    int height{};
+};
+
+struct GetMonitorPhysicalSizeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int widthMM{};
+    int heightMM{};
+};
+
+struct GetMonitorContentScaleStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    float xscale{};
+    float yscale{};
+};
+
+struct GetMonitorNameStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct SetMonitorUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetMonitorUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetMonitorCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetVideoModesStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int count{};
+    std::optional<const GLFWvidmode*> returns;
+};
+
+struct GetVideoModeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const GLFWvidmode*> returns;
+};
+
+struct SetGammaStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetGammaRampStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const GLFWgammaramp*> returns;
+};
+
+struct SetGammaRampStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct DefaultWindowHintsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct WindowHintStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct WindowHintStringStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct CreateWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWwindow*> returns;
+};
+
+struct DestroyWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct WindowShouldCloseStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct SetWindowShouldCloseStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowTitleStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct SetWindowTitleStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowIconStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowPosStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int xpos{};
+    int ypos{};
+};
+
+struct SetWindowPosStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowSizeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int width{};
+    int height{};
+};
+
+struct SetWindowSizeLimitsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowAspectRatioStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowSizeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetFramebufferSizeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int width{};
+    int height{};
+};
+
+struct GetWindowFrameSizeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int left{};
+    int top{};
+    int right{};
+    int bottom{};
+};
+
+struct GetWindowContentScaleStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    float xscale{};
+    float yscale{};
+};
+
+struct GetWindowOpacityStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<float> returns;
+};
+
+struct SetWindowOpacityStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct IconifyWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct RestoreWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct MaximizeWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct ShowWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct HideWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct FocusWindowStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct RequestWindowAttentionStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowMonitorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWmonitor*> returns;
+};
+
+struct SetWindowMonitorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowAttribStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct SetWindowAttribStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetWindowUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowPosCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowSizeCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowCloseCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowRefreshCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowFocusCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowIconifyCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowMaximizeCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetFramebufferSizeCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetWindowContentScaleCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct PollEventsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct WaitEventsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct WaitEventsTimeoutStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct PostEmptyEventStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetInputModeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct SetInputModeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct RawMouseMotionSupportedStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetKeyNameStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct GetKeyScancodeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetKeyStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetMouseButtonStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetCursorPosStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    double xpos{};
+    double ypos{};
+};
+
+struct SetCursorPosStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct CreateCursorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWcursor*> returns;
+};
+
+struct CreateStandardCursorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWcursor*> returns;
+};
+
+struct DestroyCursorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetCursorStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetKeyCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetCharCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetCharModsCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetMouseButtonCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetCursorPosCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetCursorEnterCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetScrollCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SetDropCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct JoystickPresentStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetJoystickAxesStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int count{};
+    std::optional<const float*> returns;
+};
+
+struct GetJoystickButtonsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int count{};
+    std::optional<const unsigned char*> returns;
+};
+
+struct GetJoystickHatsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    int count{};
+    std::optional<const unsigned char*> returns;
+};
+
+struct GetJoystickNameStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct GetJoystickGUIDStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct SetJoystickUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetJoystickUserPointerStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct JoystickIsGamepadStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct SetJoystickCallbackStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct UpdateGamepadMappingsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetGamepadNameStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct GetGamepadStateStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    GLFWgamepadstate state{};
+    std::optional<int> returns;
+};
+
+struct SetClipboardStringStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetClipboardStringStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<const char*> returns;
+};
+
+struct GetTimeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<double> returns;
+};
+
+struct SetTimeStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetTimerValueStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<uint64_t> returns;
+};
+
+struct GetTimerFrequencyStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<uint64_t> returns;
+};
+
+struct MakeContextCurrentStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct GetCurrentContextStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWwindow*> returns;
+};
+
+struct SwapBuffersStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct SwapIntervalStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+};
+
+struct ExtensionSupportedStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetProcAddressStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWglproc> returns;
+};
+
+struct VulkanSupportedStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+
+struct GetRequiredInstanceExtensionsStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    uint32_t count{};
+    std::optional<const char**> returns;
+};
+
+#ifdef VK_VERSION_1_0
+struct GetInstanceProcAddressStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<GLFWvkproc> returns;
+};
+#endif
+
+#ifdef VK_VERSION_1_0
+struct GetPhysicalDevicePresentationSupportStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<int> returns;
+};
+#endif
+
+#ifdef VK_VERSION_1_0
+struct CreateWindowSurfaceStub {
+    std::uint64_t calls = 0;
+    int error = GLFW_NO_ERROR;
+    std::optional<VkResult> returns;
+};
+#endif
+
+struct State {
+    InitStub init;
+    TerminateStub terminate;
+    InitHintStub initHint;
+    InitAllocatorStub initAllocator;
+    #ifdef VK_VERSION_1_0
+    InitVulkanLoaderStub initVulkanLoader;
+    #endif
+    GetVersionStub getVersion;
+    GetVersionStringStub getVersionString;
+    GetErrorStub getError;
+    SetErrorCallbackStub setErrorCallback;
+    GetPlatformStub getPlatform;
+    PlatformSupportedStub platformSupported;
+    GetMonitorsStub getMonitors;
+    GetPrimaryMonitorStub getPrimaryMonitor;
+    GetMonitorPosStub getMonitorPos;
+    GetMonitorWorkareaStub getMonitorWorkarea;
+    GetMonitorPhysicalSizeStub getMonitorPhysicalSize;
+    GetMonitorContentScaleStub getMonitorContentScale;
+    GetMonitorNameStub getMonitorName;
+    SetMonitorUserPointerStub setMonitorUserPointer;
+    GetMonitorUserPointerStub getMonitorUserPointer;
+    SetMonitorCallbackStub setMonitorCallback;
+    GetVideoModesStub getVideoModes;
+    GetVideoModeStub getVideoMode;
+    SetGammaStub setGamma;
+    GetGammaRampStub getGammaRamp;
+    SetGammaRampStub setGammaRamp;
+    DefaultWindowHintsStub defaultWindowHints;
+    WindowHintStub windowHint;
+    WindowHintStringStub windowHintString;
+    CreateWindowStub createWindow;
+    DestroyWindowStub destroyWindow;
+    WindowShouldCloseStub windowShouldClose;
+    SetWindowShouldCloseStub setWindowShouldClose;
+    GetWindowTitleStub getWindowTitle;
+    SetWindowTitleStub setWindowTitle;
+    SetWindowIconStub setWindowIcon;
+    GetWindowPosStub getWindowPos;
+    SetWindowPosStub setWindowPos;
+    GetWindowSizeStub getWindowSize;
+    SetWindowSizeLimitsStub setWindowSizeLimits;
+    SetWindowAspectRatioStub setWindowAspectRatio;
+    SetWindowSizeStub setWindowSize;
+    GetFramebufferSizeStub getFramebufferSize;
+    GetWindowFrameSizeStub getWindowFrameSize;
+    GetWindowContentScaleStub getWindowContentScale;
+    GetWindowOpacityStub getWindowOpacity;
+    SetWindowOpacityStub setWindowOpacity;
+    IconifyWindowStub iconifyWindow;
+    RestoreWindowStub restoreWindow;
+    MaximizeWindowStub maximizeWindow;
+    ShowWindowStub showWindow;
+    HideWindowStub hideWindow;
+    FocusWindowStub focusWindow;
+    RequestWindowAttentionStub requestWindowAttention;
+    GetWindowMonitorStub getWindowMonitor;
+    SetWindowMonitorStub setWindowMonitor;
+    GetWindowAttribStub getWindowAttrib;
+    SetWindowAttribStub setWindowAttrib;
+    SetWindowUserPointerStub setWindowUserPointer;
+    GetWindowUserPointerStub getWindowUserPointer;
+    SetWindowPosCallbackStub setWindowPosCallback;
+    SetWindowSizeCallbackStub setWindowSizeCallback;
+    SetWindowCloseCallbackStub setWindowCloseCallback;
+    SetWindowRefreshCallbackStub setWindowRefreshCallback;
+    SetWindowFocusCallbackStub setWindowFocusCallback;
+    SetWindowIconifyCallbackStub setWindowIconifyCallback;
+    SetWindowMaximizeCallbackStub setWindowMaximizeCallback;
+    SetFramebufferSizeCallbackStub setFramebufferSizeCallback;
+    SetWindowContentScaleCallbackStub setWindowContentScaleCallback;
+    PollEventsStub pollEvents;
+    WaitEventsStub waitEvents;
+    WaitEventsTimeoutStub waitEventsTimeout;
+    PostEmptyEventStub postEmptyEvent;
+    GetInputModeStub getInputMode;
+    SetInputModeStub setInputMode;
+    RawMouseMotionSupportedStub rawMouseMotionSupported;
+    GetKeyNameStub getKeyName;
+    GetKeyScancodeStub getKeyScancode;
+    GetKeyStub getKey;
+    GetMouseButtonStub getMouseButton;
+    GetCursorPosStub getCursorPos;
+    SetCursorPosStub setCursorPos;
+    CreateCursorStub createCursor;
+    CreateStandardCursorStub createStandardCursor;
+    DestroyCursorStub destroyCursor;
+    SetCursorStub setCursor;
+    SetKeyCallbackStub setKeyCallback;
+    SetCharCallbackStub setCharCallback;
+    SetCharModsCallbackStub setCharModsCallback;
+    SetMouseButtonCallbackStub setMouseButtonCallback;
+    SetCursorPosCallbackStub setCursorPosCallback;
+    SetCursorEnterCallbackStub setCursorEnterCallback;
+    SetScrollCallbackStub setScrollCallback;
+    SetDropCallbackStub setDropCallback;
+    JoystickPresentStub joystickPresent;
+    GetJoystickAxesStub getJoystickAxes;
+    GetJoystickButtonsStub getJoystickButtons;
+    GetJoystickHatsStub getJoystickHats;
+    GetJoystickNameStub getJoystickName;
+    GetJoystickGUIDStub getJoystickGUID;
+    SetJoystickUserPointerStub setJoystickUserPointer;
+    GetJoystickUserPointerStub getJoystickUserPointer;
+    JoystickIsGamepadStub joystickIsGamepad;
+    SetJoystickCallbackStub setJoystickCallback;
+    UpdateGamepadMappingsStub updateGamepadMappings;
+    GetGamepadNameStub getGamepadName;
+    GetGamepadStateStub getGamepadState;
+    SetClipboardStringStub setClipboardString;
+    GetClipboardStringStub getClipboardString;
+    GetTimeStub getTime;
+    SetTimeStub setTime;
+    GetTimerValueStub getTimerValue;
+    GetTimerFrequencyStub getTimerFrequency;
+    MakeContextCurrentStub makeContextCurrent;
+    GetCurrentContextStub getCurrentContext;
+    SwapBuffersStub swapBuffers;
+    SwapIntervalStub swapInterval;
+    ExtensionSupportedStub extensionSupported;
+    GetProcAddressStub getProcAddress;
+    VulkanSupportedStub vulkanSupported;
+    GetRequiredInstanceExtensionsStub getRequiredInstanceExtensions;
+    #ifdef VK_VERSION_1_0
+    GetInstanceProcAddressStub getInstanceProcAddress;
+    #endif
+    #ifdef VK_VERSION_1_0
+    GetPhysicalDevicePresentationSupportStub getPhysicalDevicePresentationSupport;
+    #endif
+    #ifdef VK_VERSION_1_0
+    CreateWindowSurfaceStub createWindowSurface;
+    #endif
+};
+
+struct WindowCallbacks {
+    GLFWwindowposfun windowPos = nullptr;
+    GLFWwindowsizefun windowSize = nullptr;
+    GLFWwindowclosefun windowClose = nullptr;
+    GLFWwindowrefreshfun windowRefresh = nullptr;
+    GLFWwindowfocusfun windowFocus = nullptr;
+    GLFWwindowiconifyfun windowIconify = nullptr;
+    GLFWwindowmaximizefun windowMaximize = nullptr;
+    GLFWframebuffersizefun framebufferSize = nullptr;
+    GLFWwindowcontentscalefun windowContentScale = nullptr;
+    GLFWkeyfun key = nullptr;
+    GLFWcharfun character = nullptr;
+    GLFWcharmodsfun charMods = nullptr;
+    GLFWmousebuttonfun mouseButton = nullptr;
+    GLFWcursorposfun cursorPos = nullptr;
+    GLFWcursorenterfun cursorEnter = nullptr;
+    GLFWscrollfun scroll = nullptr;
+    GLFWdropfun drop = nullptr;
+};
+
+struct GlobalCallbacks {
+    GLFWerrorfun error = nullptr;
+    GLFWmonitorfun monitor = nullptr;
+    GLFWjoystickfun joystick = nullptr;
+};
+// !end_generated
+
+// Stubs may be called from any thread; each call holds this lock. Read and change `state()`
+// only while no other thread is calling into the mock, or hold the lock yourself.
+std::recursive_mutex& mutex();
+
+State& state();
+
+// Callbacks registered for `window`; entries are null until set
+WindowCallbacks& windowCallbacks(GLFWwindow* window);
+
+GlobalCallbacks& globalCallbacks();
+
+// Makes the next `glfwGetError` on this thread report `code`, as if the previous call had
+// failed, and calls the error callback like GLFW does
+void injectError(int code, const char* description = "mock error");
+
+// Restores canned values, counters, callbacks, user pointers and this thread's pending error
+void reset();
+}
+
+#endif // GLFW_HPP_MOCK_INCLUDED
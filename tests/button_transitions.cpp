@@ -0,0 +1,21 @@
+// ButtonTransitions: bit queries stay within the 64 tracked buttons.
+
+#include <glfw-hpp/glfw_input.hpp>
+
+#include "./check.hpp"
+
+int main() {
+    glfw::ButtonTransitions transitions{.pressed = ~std::uint64_t{0}, .released = ~std::uint64_t{0}, .held = ~std::uint64_t{0}};
+    GLFW_HPP_CHECK(transitions.isPressed(0) && transitions.isReleased(63) && transitions.isHeld(31));
+    for (int index : {-1, -64, 64, 65, 1000}) {
+        GLFW_HPP_CHECK(!transitions.isPressed(index));
+        GLFW_HPP_CHECK(!transitions.isReleased(index));
+        GLFW_HPP_CHECK(!transitions.isHeld(index));
+    }
+    GLFW_HPP_CHECK(transitions.isPressed(glfw::GamepadButton::eA));
+
+    GLFW_HPP_CHECK(glfw::ButtonTransitions::hatMask(1, glfw::HatState::eUp) == 0x10);
+    GLFW_HPP_CHECK(glfw::ButtonTransitions::hatMask(16, glfw::HatState::eUp) == 0);
+    GLFW_HPP_CHECK(glfw::ButtonTransitions::hatMask(-1, glfw::HatState::eUp) == 0);
+    return glfw_test::result();
+}
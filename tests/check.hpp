@@ -0,0 +1,33 @@
+// Minimal checks for the glfw-hpp tests. Each test is its own executable that returns
+// `glfw_test::result()`, so CTest reports it as failed if any check failed.
+
+#ifndef GLFW_HPP_TEST_CHECK_INCLUDED
+#define GLFW_HPP_TEST_CHECK_INCLUDED
+
+#include <cstdio>
+
+#define GLFW_HPP_CHECK(condition) ::glfw_test::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+namespace glfw_test {
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+inline bool check(bool passed, const char* expression, const char* file, int line) {
+    if (!passed) {
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        ++failures();
+    }
+    return passed;
+}
+
+inline int result() {
+    if (failures() != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures());
+    }
+    return failures() == 0 ? 0 : 1;
+}
+}
+
+#endif // GLFW_HPP_TEST_CHECK_INCLUDED
@@ -0,0 +1,84 @@
+// The per-thread current-context cache: skipped switches, explicit invalidation, and
+// invalidation on every thread by terminate(), after which window addresses may be reused.
+
+#include <glfw-hpp/glfw.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <future>
+#include <thread>
+
+static glfw::Window createWindow() {
+    glfw::WindowCreateInfo info{};
+    info.width = 640;
+    info.height = 480;
+    info.title = "test";
+    return glfw::createWindow(info);
+}
+
+static std::uint64_t makeCurrentCalls() {
+    std::lock_guard lock{glfw_mock::mutex()};
+    return glfw_mock::state().makeContextCurrent.calls;
+}
+
+static void skipsRedundantSwitches() {
+    glfw_mock::reset();
+    glfw::init();
+    auto window = createWindow();
+    auto before = glfw::contextSwitchStats();
+    window.makeContextCurrent();
+    window.makeContextCurrent();
+    GLFW_HPP_CHECK(makeCurrentCalls() == 1);
+    GLFW_HPP_CHECK(glfw::currentContext() == window);
+    GLFW_HPP_CHECK(glfw_mock::state().getCurrentContext.calls == 0);
+    auto after = glfw::contextSwitchStats();
+    GLFW_HPP_CHECK(after.switches - before.switches == 1);
+    GLFW_HPP_CHECK(after.avoided - before.avoided == 1);
+
+    glfw::invalidateContextCache();
+    window.makeContextCurrent();
+    GLFW_HPP_CHECK(makeCurrentCalls() == 2);
+    glfw::terminate();
+}
+
+static void terminateInvalidatesEveryThread() {
+    glfw_mock::reset();
+    auto* reused = reinterpret_cast<GLFWwindow*>(std::uintptr_t{0x4000});
+    glfw_mock::state().createWindow.returns = reused;
+    glfw::init();
+    auto window = createWindow();
+
+    std::promise<void> madeCurrent, terminated, madeCurrentAgain;
+    std::thread worker{[&] {
+        glfw::Window{reused}.makeContextCurrent();
+        madeCurrent.set_value();
+        terminated.get_future().wait();
+        glfw::Window{reused}.makeContextCurrent();
+        madeCurrentAgain.set_value();
+    }};
+
+    madeCurrent.get_future().wait();
+    window.makeContextCurrent();
+    GLFW_HPP_CHECK(makeCurrentCalls() == 2);
+
+    // A new session hands out the same address; both threads must switch for real
+    glfw::terminate();
+    glfw::init();
+    auto recreated = createWindow();
+    GLFW_HPP_CHECK(recreated.handle() == reused);
+    terminated.set_value();
+    madeCurrentAgain.get_future().wait();
+    worker.join();
+    GLFW_HPP_CHECK(makeCurrentCalls() == 3);
+
+    recreated.makeContextCurrent();
+    GLFW_HPP_CHECK(makeCurrentCalls() == 4);
+    glfw::terminate();
+}
+
+int main() {
+    skipsRedundantSwitches();
+    terminateInvalidatesEveryThread();
+    return glfw_test::result();
+}
@@ -0,0 +1,91 @@
+// CursorCache: least recently used entries are evicted first under the entry and byte
+// limits, and an evicted cursor is destroyed only once its last handle is released.
+
+#include <glfw-hpp/glfw_image.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <array>
+
+struct TestImage {
+    std::array<unsigned char, 4 * 4 * 4> pixels{};
+
+    explicit TestImage(unsigned char value) {
+        pixels.fill(value);
+    }
+
+    glfw::Image image() {
+        return {4, 4, pixels.data()};
+    }
+};
+
+static void evictsLeastRecentlyUsed() {
+    glfw_mock::reset();
+    glfw::init();
+    TestImage a{1}, b{2}, c{3};
+    glfw::CursorCache cache{2};
+
+    (void)cache.get(a.image(), 0, 0);
+    (void)cache.get(b.image(), 0, 0);
+    (void)cache.get(a.image(), 0, 0);
+    (void)cache.get(c.image(), 0, 0);
+    auto stats = cache.stats();
+    GLFW_HPP_CHECK(stats.hits == 1 && stats.misses == 3);
+    GLFW_HPP_CHECK(stats.evictions == 1 && stats.entries == 2);
+    GLFW_HPP_CHECK(glfw_mock::state().destroyCursor.calls == 1);
+
+    // b was evicted, a and c stay cached
+    (void)cache.get(a.image(), 0, 0);
+    (void)cache.get(c.image(), 0, 0);
+    GLFW_HPP_CHECK(cache.stats().hits == 3);
+    GLFW_HPP_CHECK(glfw_mock::state().createCursor.calls == 3);
+    (void)cache.get(b.image(), 0, 0);
+    GLFW_HPP_CHECK(cache.stats().misses == 4);
+    GLFW_HPP_CHECK(glfw_mock::state().createCursor.calls == 4);
+
+    // The hotspot is part of the key
+    (void)cache.get(b.image(), 1, 1);
+    GLFW_HPP_CHECK(cache.stats().misses == 5);
+    glfw::terminate();
+}
+
+static void evictsByBytes() {
+    glfw_mock::reset();
+    glfw::init();
+    TestImage a{1}, b{2}, c{3};
+    glfw::CursorCache cache{0, 2 * a.pixels.size()};
+    (void)cache.get(a.image(), 0, 0);
+    (void)cache.get(b.image(), 0, 0);
+    (void)cache.get(c.image(), 0, 0);
+    GLFW_HPP_CHECK(cache.stats().entries == 2);
+    GLFW_HPP_CHECK(cache.stats().bytes == 2 * a.pixels.size());
+
+    cache.setLimits(1, 0);
+    GLFW_HPP_CHECK(cache.stats().entries == 1);
+    GLFW_HPP_CHECK(cache.stats().evictions == 2);
+    (void)cache.get(c.image(), 0, 0);
+    GLFW_HPP_CHECK(cache.stats().hits == 1);
+    glfw::terminate();
+}
+
+static void keepsEvictedCursorsInUse() {
+    glfw_mock::reset();
+    glfw::init();
+    TestImage a{1}, b{2};
+    glfw::CursorCache cache{1};
+    auto held = cache.get(a.image(), 0, 0);
+    (void)cache.get(b.image(), 0, 0);
+    GLFW_HPP_CHECK(cache.stats().evictions == 1);
+    GLFW_HPP_CHECK(glfw_mock::state().destroyCursor.calls == 0);
+    held.reset();
+    GLFW_HPP_CHECK(glfw_mock::state().destroyCursor.calls == 1);
+    glfw::terminate();
+}
+
+int main() {
+    evictsLeastRecentlyUsed();
+    evictsByBytes();
+    keepsEvictedCursorsInUse();
+    return glfw_test::result();
+}
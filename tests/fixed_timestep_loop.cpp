@@ -0,0 +1,133 @@
+// FixedTimestepLoop: slicing queued events into ticks, clamping the catch-up, and chaining
+// to and restoring the window's own input handlers.
+
+#include <glfw-hpp/glfw_timing.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <vector>
+
+static glfw::Window createWindow() {
+    glfw::WindowCreateInfo info{};
+    info.width = 640;
+    info.height = 480;
+    info.title = "test";
+    return glfw::createWindow(info);
+}
+
+static void setTime(std::uint64_t ticks) {
+    glfw_mock::state().getTimerValue.returns = ticks;
+}
+
+static void pressKey(glfw::Window window, int key) {
+    glfw_mock::windowCallbacks(window.handle()).key(window.handle(), key, 0, GLFW_PRESS, 0);
+}
+
+// Timer at 1000 Hz and 100 ticks per second: one tick is 10 timer units
+static void slicesEventsIntoTicks() {
+    glfw_mock::reset();
+    glfw_mock::state().getTimerFrequency.returns = 1000;
+    glfw::init();
+    auto window = createWindow();
+    glfw::FixedTimestepLoop loop{100.0};
+    loop.attach(window);
+
+    std::vector<std::vector<glfw::Key>> ticks;
+    auto record = [&](std::span<const glfw::InputEvent> events) {
+        ticks.emplace_back();
+        for (const auto& event : events) {
+            ticks.back().push_back(event.key);
+        }
+    };
+
+    setTime(0);
+    GLFW_HPP_CHECK(loop.advance(record) == 0);
+
+    setTime(5);
+    pressKey(window, GLFW_KEY_A);
+    setTime(15);
+    pressKey(window, GLFW_KEY_B);
+    setTime(25);
+    GLFW_HPP_CHECK(loop.advance(record) == 2);
+    GLFW_HPP_CHECK(ticks.size() == 2);
+    GLFW_HPP_CHECK(ticks[0] == std::vector{glfw::Key::eA});
+    GLFW_HPP_CHECK(ticks[1] == std::vector{glfw::Key::eB});
+    GLFW_HPP_CHECK(loop.alpha() == 0.5);
+
+    // Events after the last tick boundary are still delivered by the last tick
+    setTime(29);
+    pressKey(window, GLFW_KEY_C);
+    setTime(31);
+    ticks.clear();
+    GLFW_HPP_CHECK(loop.advance(record) == 1);
+    GLFW_HPP_CHECK(ticks.size() == 1 && ticks[0] == std::vector{glfw::Key::eC});
+    GLFW_HPP_CHECK(loop.ticks() == 3);
+
+    loop.detach();
+    glfw::terminate();
+}
+
+static void clampsCatchUp() {
+    glfw_mock::reset();
+    glfw_mock::state().getTimerFrequency.returns = 1000;
+    glfw::init();
+    glfw::FixedTimestepLoop loop{100.0};
+    loop.setMaxTicksPerFrame(3);
+    auto ignore = [](std::span<const glfw::InputEvent>) {};
+
+    setTime(0);
+    (void)loop.advance(ignore);
+    setTime(1005);
+    GLFW_HPP_CHECK(loop.advance(ignore) == 3);
+    GLFW_HPP_CHECK(loop.alpha() == 0.5);
+    setTime(1015);
+    GLFW_HPP_CHECK(loop.advance(ignore) == 1);
+    glfw::terminate();
+}
+
+static void chainsAndRestoresHandlers() {
+    glfw_mock::reset();
+    glfw::init();
+    auto window = createWindow();
+    int userKeys = 0;
+    window.setKeyHandler([&](glfw::Key, int, glfw::Action, glfw::Mods) { userKeys += 1; });
+
+    std::size_t queued = 0;
+    auto count = [&](std::span<const glfw::InputEvent> events) { queued += events.size(); };
+    glfw_mock::state().getTimerFrequency.returns = 1000;
+    setTime(0);
+    {
+        glfw::FixedTimestepLoop loop{100.0};
+        loop.attach(window);
+        loop.attach(window);
+        (void)loop.advance(count);
+        pressKey(window, GLFW_KEY_A);
+        GLFW_HPP_CHECK(userKeys == 1);
+        setTime(10);
+        (void)loop.advance(count);
+        GLFW_HPP_CHECK(queued == 1);
+
+        loop.detach(window);
+        pressKey(window, GLFW_KEY_A);
+        GLFW_HPP_CHECK(userKeys == 2);
+        setTime(20);
+        (void)loop.advance(count);
+        GLFW_HPP_CHECK(queued == 1);
+
+        // Left attached: the handlers outlive the loop and keep forwarding
+        loop.attach(window);
+    }
+    pressKey(window, GLFW_KEY_A);
+    GLFW_HPP_CHECK(userKeys == 3);
+
+    window.destroy();
+    glfw::terminate();
+}
+
+int main() {
+    slicesEventsIntoTicks();
+    clampsCatchUp();
+    chainsAndRestoresHandlers();
+    return glfw_test::result();
+}
@@ -0,0 +1,76 @@
+// GamepadMappingDatabase: last mapping wins, other platforms are dropped, the binary index
+// round-trips, and connected joysticks are submitted once.
+
+#include <glfw-hpp/glfw_input.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <string>
+
+#if defined(_WIN32)
+#define TEST_PLATFORM "Windows"
+#define TEST_OTHER_PLATFORM "Linux"
+#else
+#define TEST_PLATFORM "Linux"
+#define TEST_OTHER_PLATFORM "Windows"
+#endif
+
+static constexpr std::string_view kPadA = "03000000de280000ff11000001000000";
+static constexpr std::string_view kPadB = "050000005e040000fd02000030110000";
+
+static const std::string kDatabase =
+    "# comment\r\n"
+    "03000000de280000ff11000001000000,First,a:b0,platform:" TEST_PLATFORM ",\r\n"
+    "050000005e040000fd02000030110000,Other,a:b1,platform:" TEST_OTHER_PLATFORM ",\n"
+    "\n"
+    "03000000de280000ff11000001000000,Second,a:b2,platform:" TEST_PLATFORM ",\n"
+    "invalid line\n"
+    "030000004c050000cc09000011010000,Anywhere,a:b3,\n";
+
+static void indexesText() {
+    glfw::GamepadMappingDatabase database{kDatabase};
+    GLFW_HPP_CHECK(database.size() == 2);
+    auto mapping = database.find(kPadA);
+    GLFW_HPP_CHECK(mapping && mapping->find(",Second,") != std::string_view::npos);
+    GLFW_HPP_CHECK(mapping && mapping->back() != '\r');
+    GLFW_HPP_CHECK(!database.find(kPadB));
+    GLFW_HPP_CHECK(database.find("030000004c050000cc09000011010000").has_value());
+    GLFW_HPP_CHECK(!database.find("invalid line"));
+}
+
+static void roundTripsBinary() {
+    glfw::GamepadMappingDatabase text{kDatabase};
+    std::string binary = text.toBinary();
+    auto database = glfw::GamepadMappingDatabase::fromBinary(binary);
+    GLFW_HPP_CHECK(database.has_value());
+    GLFW_HPP_CHECK(database && database->size() == 2);
+    GLFW_HPP_CHECK(database && database->find(kPadA) == text.find(kPadA));
+    GLFW_HPP_CHECK(database && database->toBinary() == binary);
+
+    GLFW_HPP_CHECK(!glfw::GamepadMappingDatabase::fromBinary(kDatabase));
+    GLFW_HPP_CHECK(!glfw::GamepadMappingDatabase::fromBinary(std::string_view{binary}.substr(0, 20)));
+    GLFW_HPP_CHECK(!glfw::GamepadMappingDatabase::fromBinary(std::string_view{binary}.substr(0, binary.size() - 10)));
+    GLFW_HPP_CHECK(glfw::GamepadMappingDatabase::fromBinary(glfw::GamepadMappingDatabase{}.toBinary()).has_value());
+}
+
+static void submitsConnectedOnce() {
+    glfw_mock::reset();
+    glfw_mock::state().joystickPresent.returns = GLFW_TRUE;
+    glfw_mock::state().getJoystickGUID.returns = kPadA.data();
+    glfw_mock::state().updateGamepadMappings.returns = GLFW_TRUE;
+    glfw::init();
+    glfw::GamepadMappingDatabase database{kDatabase};
+    GLFW_HPP_CHECK(database.submitConnected());
+    GLFW_HPP_CHECK(glfw_mock::state().updateGamepadMappings.calls == 1);
+    GLFW_HPP_CHECK(database.submitConnected());
+    GLFW_HPP_CHECK(glfw_mock::state().updateGamepadMappings.calls == 1);
+    glfw::terminate();
+}
+
+int main() {
+    indexesText();
+    roundTripsBinary();
+    submitsConnectedOnce();
+    return glfw_test::result();
+}
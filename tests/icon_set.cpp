@@ -0,0 +1,85 @@
+// IconSet: non-square sources are center-cropped, sizes above the shorter side are
+// skipped, and transparent pixels do not darken the downscaled colors.
+
+#include <glfw-hpp/glfw_image.hpp>
+
+#include "./check.hpp"
+
+#include <vector>
+
+static void fill(std::vector<unsigned char>& pixels, int width, int x0, int x1, int height,
+                 unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+    for (int y = 0; y < height; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            unsigned char* pixel = pixels.data() + (static_cast<std::size_t>(y) * width + x) * 4;
+            pixel[0] = r;
+            pixel[1] = g;
+            pixel[2] = b;
+            pixel[3] = a;
+        }
+    }
+}
+
+static bool allPixels(const GLFWimage& image, unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+    for (int i = 0; i < image.width * image.height; ++i) {
+        const unsigned char* pixel = image.pixels + i * 4;
+        if (pixel[0] != r || pixel[1] != g || pixel[2] != b || pixel[3] != a) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 64x32 with red and blue bands outside the centered 32x32 green square
+static void cropsWideSource() {
+    std::vector<unsigned char> pixels(64 * 32 * 4);
+    fill(pixels, 64, 0, 16, 32, 255, 0, 0, 255);
+    fill(pixels, 64, 16, 48, 32, 0, 255, 0, 255);
+    fill(pixels, 64, 48, 64, 32, 0, 0, 255, 255);
+
+    int sizes[] = {16, 32, 48};
+    glfw::IconSet icons{glfw::Image{64, 32, pixels.data()}, sizes};
+    auto images = icons.images();
+    GLFW_HPP_CHECK(images.size() == 2);
+    for (const auto& image : images) {
+        GLFW_HPP_CHECK(image.width == image.height);
+        GLFW_HPP_CHECK(allPixels(image, 0, 255, 0, 255));
+    }
+}
+
+// 24x48, cropped to rows 12..35
+static void cropsTallSource() {
+    std::vector<unsigned char> pixels(24 * 48 * 4);
+    fill(pixels, 24, 0, 24, 48, 255, 0, 0, 255);
+    for (int y = 12; y < 36; ++y) {
+        for (int x = 0; x < 24; ++x) {
+            unsigned char* pixel = pixels.data() + (static_cast<std::size_t>(y) * 24 + x) * 4;
+            pixel[0] = 0;
+            pixel[2] = 255;
+        }
+    }
+
+    glfw::IconSet icons{glfw::Image{24, 48, pixels.data()}};
+    auto images = icons.images();
+    GLFW_HPP_CHECK(images.size() == 1 && images[0].width == 16);
+    GLFW_HPP_CHECK(!images.empty() && allPixels(images[0], 0, 0, 255, 255));
+}
+
+static void ignoresTransparentColor() {
+    std::vector<unsigned char> pixels(2 * 2 * 4);
+    fill(pixels, 2, 0, 2, 2, 200, 100, 50, 255);
+    fill(pixels, 2, 0, 1, 1, 0, 0, 0, 0);
+
+    int sizes[] = {1};
+    glfw::IconSet icons{glfw::Image{2, 2, pixels.data()}, sizes};
+    auto images = icons.images();
+    GLFW_HPP_CHECK(images.size() == 1);
+    GLFW_HPP_CHECK(!images.empty() && allPixels(images[0], 200, 100, 50, 191));
+}
+
+int main() {
+    cropsWideSource();
+    cropsTallSource();
+    ignoresTransparentColor();
+    return glfw_test::result();
+}
@@ -0,0 +1,69 @@
+// The mock backend itself: canned values, call counts, injected errors and callbacks
+// registered through the wrapper.
+
+#include <glfw-hpp/glfw.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <thread>
+
+static glfw::Window createWindow() {
+    glfw::WindowCreateInfo info{};
+    info.width = 640;
+    info.height = 480;
+    info.title = "test";
+    return glfw::createWindow(info);
+}
+
+static void cannedValues() {
+    glfw_mock::reset();
+    glfw_mock::state().getVersionString.returns = "3.4.0 test";
+    GLFW_HPP_CHECK(glfw::getVersionString() == "3.4.0 test");
+    GLFW_HPP_CHECK(glfw_mock::state().getVersionString.calls == 1);
+
+    glfw_mock::state().getVersion.major = 3;
+    glfw_mock::state().getVersion.minor = 4;
+    auto version = glfw::getVersion();
+    GLFW_HPP_CHECK(version.major == 3 && version.minor == 4);
+}
+
+static void injectedErrors() {
+    glfw_mock::reset();
+    glfw_mock::state().createWindow.error = GLFW_PLATFORM_ERROR;
+    int code = GLFW_NO_ERROR;
+    try {
+        (void)createWindow();
+    } catch (const glfw::GLFWException& exception) {
+        code = exception.errorCode();
+    }
+    GLFW_HPP_CHECK(code == GLFW_PLATFORM_ERROR);
+    GLFW_HPP_CHECK(::glfwGetError(nullptr) == GLFW_NO_ERROR);
+
+    // The error callback sees injected errors, and errors stay on the thread that raised them
+    static int reported = GLFW_NO_ERROR;
+    ::glfwSetErrorCallback([](int error, const char*) { reported = error; });
+    std::thread{[] { glfw_mock::injectError(GLFW_INVALID_ENUM); }}.join();
+    GLFW_HPP_CHECK(reported == GLFW_INVALID_ENUM);
+    GLFW_HPP_CHECK(::glfwGetError(nullptr) == GLFW_NO_ERROR);
+}
+
+static void windowCallbacks() {
+    glfw_mock::reset();
+    auto window = createWindow();
+    glfw::Key pressed = glfw::Key::eUnknown;
+    window.setKeyHandler([&](glfw::Key key, int, glfw::Action, glfw::Mods) { pressed = key; });
+
+    auto& callbacks = glfw_mock::windowCallbacks(window.handle());
+    GLFW_HPP_CHECK(callbacks.key != nullptr);
+    callbacks.key(window.handle(), GLFW_KEY_SPACE, 0, GLFW_PRESS, 0);
+    GLFW_HPP_CHECK(pressed == glfw::Key::eSpace);
+    window.destroy();
+}
+
+int main() {
+    cannedValues();
+    injectedErrors();
+    windowCallbacks();
+    return glfw_test::result();
+}
@@ -0,0 +1,61 @@
+// The SIMD and scalar paths of the ImageBuffer conversions agree for every input.
+// A 256x256 image takes the SIMD path; single pixels always take the scalar tail.
+
+#include <glfw-hpp/glfw_image.hpp>
+
+#include "./check.hpp"
+
+#include <cstdio>
+#include <vector>
+
+// Every (color, alpha) pair, with the other channels varied as well
+static std::vector<unsigned char> allPairs() {
+    std::vector<unsigned char> pixels(256 * 256 * 4);
+    for (int alpha = 0; alpha < 256; ++alpha) {
+        for (int color = 0; color < 256; ++color) {
+            unsigned char* pixel = pixels.data() + (alpha * 256 + color) * 4;
+            pixel[0] = static_cast<unsigned char>(color);
+            pixel[1] = static_cast<unsigned char>(255 - color);
+            pixel[2] = static_cast<unsigned char>(color / 2);
+            pixel[3] = static_cast<unsigned char>(alpha);
+        }
+    }
+    return pixels;
+}
+
+// Compares each pixel of `wide` with the same conversion applied to that pixel alone
+template <typename Convert>
+static int mismatches(const char* name, const glfw::ImageBuffer& wide, Convert&& convert) {
+    int count = 0;
+    for (int i = 0; i < wide.width() * wide.height(); ++i) {
+        glfw::ImageBuffer single = convert(i);
+        for (int c = 0; c < 4; ++c) {
+            unsigned char simd = wide.pixels()[i * 4 + c];
+            unsigned char scalar = single.pixels()[c];
+            if (simd != scalar && ++count <= 10) {
+                std::printf("%s: pixel %d channel %d: wide %d, single %d\n", name, i, c, simd, scalar);
+            }
+        }
+    }
+    return count;
+}
+
+int main() {
+    std::vector<unsigned char> pixels = allPairs();
+
+    auto unpremultiplied = glfw::ImageBuffer::fromPremultipliedRGBA(pixels.data(), 256, 256);
+    GLFW_HPP_CHECK(mismatches("unpremultiply", unpremultiplied, [&](int i) {
+        return glfw::ImageBuffer::fromPremultipliedRGBA(pixels.data() + i * 4, 1, 1);
+    }) == 0);
+
+    auto swapped = glfw::ImageBuffer::fromBGRA(pixels.data(), 256, 256);
+    GLFW_HPP_CHECK(mismatches("swapRedBlue", swapped, [&](int i) {
+        return glfw::ImageBuffer::fromBGRA(pixels.data() + i * 4, 1, 1);
+    }) == 0);
+
+    auto gray = glfw::ImageBuffer::fromGrayscale(pixels.data(), 256, 256);
+    GLFW_HPP_CHECK(mismatches("fromGrayscale", gray, [&](int i) {
+        return glfw::ImageBuffer::fromGrayscale(pixels.data() + i, 1, 1);
+    }) == 0);
+    return glfw_test::result();
+}
@@ -0,0 +1,81 @@
+// ProcTable: one query per extension group, gated entries left unresolved, and typed
+// dispatch through Proc indices.
+
+#include <glfw-hpp/glfw_context.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+static int g_calls = 0;
+static int g_last = 0;
+
+static void GLFW_HPP_GLAPI fakeProc(int value) {
+    g_calls += 1;
+    g_last = value;
+}
+
+using Fake = void (GLFW_HPP_GLAPI*)(int);
+
+static constexpr std::array<glfw::ProcEntry, 4> kEntries{{
+    {"glCore"},
+    {"glExtA1", "GL_EXT_a"},
+    {"glExtA2", "GL_EXT_a"},
+    {"glExtB", "GL_EXT_b"},
+}};
+static constexpr glfw::Proc<Fake> kCore{0};
+static constexpr glfw::Proc<Fake> kExtB{3};
+
+static void gatesExtensions() {
+    glfw_mock::reset();
+    glfw::init();
+    glfw_mock::state().getProcAddress.returns = reinterpret_cast<GLFWglproc>(&fakeProc);
+    glfw_mock::state().extensionSupported.returns = GLFW_FALSE;
+
+    glfw::ProcTable table{kEntries};
+    GLFW_HPP_CHECK(table.load() == 3);
+    GLFW_HPP_CHECK(table.missing() == 3);
+    GLFW_HPP_CHECK(glfw_mock::state().extensionSupported.calls == 2);
+    GLFW_HPP_CHECK(glfw_mock::state().getProcAddress.calls == 1);
+    GLFW_HPP_CHECK(table.isLoaded(kCore));
+    GLFW_HPP_CHECK(!table.isLoaded(kExtB));
+    GLFW_HPP_CHECK(table[kExtB] == nullptr);
+
+    glfw_mock::state().extensionSupported.returns = GLFW_TRUE;
+    GLFW_HPP_CHECK(table.load() == 0);
+    GLFW_HPP_CHECK(table.isLoaded(kExtB));
+    glfw::terminate();
+}
+
+static void dispatchesTyped() {
+    glfw_mock::reset();
+    glfw::init();
+    glfw_mock::state().getProcAddress.returns = reinterpret_cast<GLFWglproc>(&fakeProc);
+    glfw_mock::state().extensionSupported.returns = GLFW_TRUE;
+
+    glfw::ProcTable table{kEntries};
+    (void)table.load();
+    g_calls = 0;
+    table[kCore](7);
+    table[kExtB](9);
+    GLFW_HPP_CHECK(g_calls == 2);
+    GLFW_HPP_CHECK(g_last == 9);
+    GLFW_HPP_CHECK(table.get<Fake>(kCore.index) == table[kCore]);
+    glfw::terminate();
+}
+
+static void reportsMissingEntryPoints() {
+    glfw_mock::reset();
+    glfw::init();
+    glfw_mock::state().extensionSupported.returns = GLFW_TRUE;
+    glfw::ProcTable table{kEntries};
+    GLFW_HPP_CHECK(table.load() == 4);
+    GLFW_HPP_CHECK(!table.isLoaded(kCore));
+    glfw::terminate();
+}
+
+int main() {
+    gatesExtensions();
+    dispatchesTyped();
+    reportsMissingEntryPoints();
+    return glfw_test::result();
+}
@@ -0,0 +1,105 @@
+// SharedContextPool: completions run by collect() or by destroying the pool, window hints
+// reset around context creation, and workers whose context cannot be made current.
+
+#include <glfw-hpp/glfw_context.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <atomic>
+#include <thread>
+
+static glfw::Window createWindow() {
+    glfw::WindowCreateInfo info{};
+    info.width = 640;
+    info.height = 480;
+    info.title = "test";
+    return glfw::createWindow(info);
+}
+
+// Collects until `count` completions ran; the mock has no fences, so tasks finish immediately
+static std::size_t collectAll(glfw::SharedContextPool& pool, std::size_t count) {
+    std::size_t completed = 0;
+    for (int attempt = 0; attempt < 100000 && completed < count; ++attempt) {
+        completed += pool.collect();
+        std::this_thread::yield();
+    }
+    return completed;
+}
+
+static void collectsCompletions() {
+    glfw_mock::reset();
+    glfw::init();
+    auto window = createWindow();
+    {
+        glfw::SharedContextPool pool{window, 2};
+        GLFW_HPP_CHECK(pool.size() == 2);
+        {
+            std::lock_guard lock{glfw_mock::mutex()};
+            GLFW_HPP_CHECK(glfw_mock::state().createWindow.calls == 3);
+            GLFW_HPP_CHECK(glfw_mock::state().defaultWindowHints.calls == 2);
+        }
+
+        std::atomic<int> tasks{0};
+        int completions = 0;
+        for (int i = 0; i < 4; ++i) {
+            pool.submit([&] { tasks += 1; }, [&] { completions += 1; });
+        }
+        GLFW_HPP_CHECK(collectAll(pool, 4) == 4);
+        GLFW_HPP_CHECK(tasks == 4);
+        GLFW_HPP_CHECK(completions == 4);
+        GLFW_HPP_CHECK(pool.collect() == 0);
+    }
+    GLFW_HPP_CHECK(glfw_mock::state().destroyWindow.calls == 2);
+    glfw::terminate();
+}
+
+static void destructionRunsPendingCompletions() {
+    glfw_mock::reset();
+    glfw::init();
+    auto window = createWindow();
+    std::atomic<int> tasks{0};
+    int completions = 0;
+    {
+        glfw::SharedContextPool pool{window, 1};
+        for (int i = 0; i < 3; ++i) {
+            pool.submit([&] { tasks += 1; }, [&] { completions += 1; });
+        }
+        pool.submit([] { throw 1; }, [&] { completions += 100; });
+    }
+    GLFW_HPP_CHECK(tasks == 3);
+    GLFW_HPP_CHECK(completions == 3);
+    glfw::terminate();
+}
+
+static void contextErrorFailsTasks() {
+    glfw_mock::reset();
+    glfw::init();
+    auto window = createWindow();
+    glfw_mock::state().makeContextCurrent.error = GLFW_PLATFORM_ERROR;
+    {
+        glfw::SharedContextPool pool{window, 1};
+        int completions = 0;
+        pool.submit([] {}, [&] { completions += 1; });
+
+        int code = GLFW_NO_ERROR;
+        for (int attempt = 0; attempt < 100000 && code == GLFW_NO_ERROR; ++attempt) {
+            try {
+                (void)pool.collect();
+            } catch (const glfw::GLFWException& exception) {
+                code = exception.errorCode();
+            }
+            std::this_thread::yield();
+        }
+        GLFW_HPP_CHECK(code == GLFW_PLATFORM_ERROR);
+        GLFW_HPP_CHECK(completions == 0);
+    }
+    glfw::terminate();
+}
+
+int main() {
+    collectsCompletions();
+    destructionRunsPendingCompletions();
+    contextErrorFailsTasks();
+    return glfw_test::result();
+}
@@ -0,0 +1,88 @@
+// ShortcutMatcher: chord sequences, key repeats, the chord timeout and reset().
+
+#include <glfw-hpp/glfw_input.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+using glfw::Action;
+using glfw::Key;
+using glfw::Mods;
+
+static constexpr glfw::ShortcutMatcher::CommandId kComment = 1;
+static constexpr glfw::ShortcutMatcher::CommandId kSave = 2;
+
+static void setTime(std::uint64_t ticks) {
+    glfw_mock::state().getTimerValue.returns = ticks;
+}
+
+static std::optional<glfw::ShortcutMatcher::CommandId> press(glfw::ShortcutMatcher& matcher, Key key, Action action = Action::ePress) {
+    return matcher.feed(key, 0, action, Mods{GLFW_MOD_CONTROL});
+}
+
+// Ctrl+K Ctrl+C comments, Ctrl+S saves; the timer runs at 1000 Hz
+static glfw::ShortcutMatcher createMatcher() {
+    glfw_mock::reset();
+    glfw_mock::state().getTimerFrequency.returns = 1000;
+    setTime(0);
+    glfw::ShortcutMatcher matcher;
+    Mods ctrl{GLFW_MOD_CONTROL};
+    GLFW_HPP_CHECK(matcher.add({{Key::eK, ctrl}, {Key::eC, ctrl}}, kComment));
+    GLFW_HPP_CHECK(matcher.add({{Key::eS, ctrl}}, kSave));
+    matcher.setChordTimeout(0.5);
+    return matcher;
+}
+
+static void matchesSequences() {
+    auto matcher = createMatcher();
+    GLFW_HPP_CHECK(press(matcher, Key::eS) == kSave);
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    GLFW_HPP_CHECK(matcher.isPending());
+    GLFW_HPP_CHECK(press(matcher, Key::eC) == kComment);
+    GLFW_HPP_CHECK(!matcher.isPending());
+}
+
+static void ignoresRepeats() {
+    auto matcher = createMatcher();
+    GLFW_HPP_CHECK(press(matcher, Key::eS) == kSave);
+    GLFW_HPP_CHECK(!press(matcher, Key::eS, Action::eRepeat));
+
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    GLFW_HPP_CHECK(!press(matcher, Key::eK, Action::eRepeat));
+    GLFW_HPP_CHECK(!press(matcher, Key::eK, Action::eRelease));
+    GLFW_HPP_CHECK(matcher.isPending());
+    GLFW_HPP_CHECK(press(matcher, Key::eC) == kComment);
+}
+
+static void dropsSequenceAfterTimeout() {
+    auto matcher = createMatcher();
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    setTime(400);
+    GLFW_HPP_CHECK(press(matcher, Key::eC) == kComment);
+
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    setTime(1000);
+    GLFW_HPP_CHECK(!press(matcher, Key::eC));
+    GLFW_HPP_CHECK(!matcher.isPending());
+
+    // A chord that starts a binding on its own still matches after the timeout
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    setTime(2000);
+    GLFW_HPP_CHECK(press(matcher, Key::eS) == kSave);
+}
+
+static void resetDropsSequence() {
+    auto matcher = createMatcher();
+    GLFW_HPP_CHECK(!press(matcher, Key::eK));
+    matcher.reset();
+    GLFW_HPP_CHECK(!matcher.isPending());
+    GLFW_HPP_CHECK(!press(matcher, Key::eC));
+}
+
+int main() {
+    matchesSequences();
+    ignoresRepeats();
+    dropsSequenceAfterTimeout();
+    resetDropsSequence();
+    return glfw_test::result();
+}
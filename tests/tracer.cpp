@@ -0,0 +1,55 @@
+// Tracer: buffers grow chunk by chunk up to their capacity, events past it are counted as
+// dropped, and traced GLFW calls are recorded.
+
+#include <glfw-hpp/glfw.hpp>
+#include <glfw_mock.hpp>
+
+#include "./check.hpp"
+
+#include <cstdio>
+#include <string>
+
+static std::size_t countEvents(const std::string& path) {
+    std::string text;
+    if (std::FILE* file = std::fopen(path.c_str(), "r")) {
+        char chunk[16384];
+        std::size_t read;
+        while ((read = std::fread(chunk, 1, sizeof(chunk), file)) != 0) {
+            text.append(chunk, read);
+        }
+        std::fclose(file);
+    }
+    std::size_t count = 0;
+    for (auto at = text.find("\"ph\":\"X\""); at != std::string::npos; at = text.find("\"ph\":\"X\"", at + 1)) {
+        count += 1;
+    }
+    return count;
+}
+
+int main() {
+    glfw_mock::reset();
+    glfw_mock::state().getTimerFrequency.returns = 1000000;
+    std::string path = "glfw-hpp-test-tracer.json";
+
+    glfw::Tracer::clear();
+    glfw::Tracer::start();
+    for (std::uint64_t i = 0; i < 5000; ++i) {
+        glfw::Tracer::record("span", "test", i + 1, i + 2);
+    }
+    GLFW_HPP_CHECK(glfw::Tracer::writeChromeTrace(path));
+    GLFW_HPP_CHECK(countEvents(path) == 5000);
+    GLFW_HPP_CHECK(glfw::Tracer::droppedEvents() == 0);
+
+    for (std::uint64_t i = 5000; i < 70000; ++i) {
+        glfw::Tracer::record("span", "test", i + 1, i + 2);
+    }
+    GLFW_HPP_CHECK(glfw::Tracer::droppedEvents() == 70000 - 65536);
+
+    glfw::Tracer::clear();
+    (void)glfw::time();
+    GLFW_HPP_CHECK(glfw::Tracer::writeChromeTrace(path));
+    GLFW_HPP_CHECK(countEvents(path) == 1);
+    glfw::Tracer::stop();
+    std::remove(path.c_str());
+    return glfw_test::result();
+}